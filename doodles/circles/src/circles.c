@@ -6,11 +6,7 @@
 
 void drawFilledCircle(uint16_t x0, uint16_t y0, uint16_t radius, uint8_t col) {
 	bitmapSetColor(col);
-	for (int16_t y = -radius; y <= (int16_t)radius; y++) {
-		int16_t yy = (int16_t)y0 + y;
-		if (yy < 0 || yy >= HEIGHT) continue;
-		bitmapLine(x0 - radius, yy, x0 + radius, yy);
-	}
+	bitmapFillCircle(x0, y0, radius);
 }
 
 int main(int argc, char *argv[]) {
@@ -32,11 +28,7 @@ int main(int argc, char *argv[]) {
 	bitmapSetVisible(2, false);
 
 	bitmapSetColor(0);
-	for (uint16_t xi = 0; xi < 320; xi++) {
-		for (uint8_t yi = 0; yi < 240; yi++) {
-			bitmapPutPixel(xi, yi);
-		}
-	}
+	bitmapClear();
 	printf("go");
 	while (true) {
 		x = randomRead();
@@ -10,8 +10,6 @@
 
 
 void setup(void) {
-	uint16_t c;
-
 	POKE(MMU_IO_CTRL, 0x00);
 	POKE(VKY_MSTR_CTRL_0, 0b00001111);
 	POKE(VKY_MSTR_CTRL_1, 0b00010100);
@@ -21,12 +19,7 @@ void setup(void) {
 	POKE(0xD00E, 0x00);
 	POKE(0xD00F, 0x00);
 
-	POKE(MMU_IO_CTRL, 1);
-	for (c = 0; c < 1023; c++) {
-		POKE(VKY_GR_CLUT_0 + c, FAR_PEEK(PAL_BASE + c));
-	}
-
-	POKE(MMU_IO_CTRL, 0x00);
+	graphicsLoadPalette(0, PAL_BASE, 0, 256);
 
 	bitmapSetActive(0);
 	bitmapSetCLUT(0);
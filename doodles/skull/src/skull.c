@@ -1,2031 +1,912 @@
 /*
  * Skull wireframe doodle.
  * Ported from F256KsimpleCdoodles for oscar64.
- * Uses native float operations instead of fp_module.h software float.
+ * Uses the library mesh module (fixed point) instead of per-line float math.
  */
 
 #include "f256lib.h"
-// fp_module.h not needed for oscar64 - native float support available
 
-
-
-
-#define CENTERX 160
-#define CENTERY 150
-#define RADIUS 100.0
-#define TOTALINDEX 60
-
-float scene_vertices[] = {
-    0.528950, -0.251500, 0.232890,
-    0.443090, -0.554420, 0.380540,
-    0.533590, -0.667800, 0.069910,
-    0.130140, -0.592940, 0.864480,
-    0.224890, -0.573850, 0.713340,
-    0.287870, -0.904960, 0.596760,
-    0.149380, -0.952480, 0.763790,
-    0.594770, -0.079980, 0.081700,
-    0.533590, -0.667800, 0.069910,
-    0.578910, -0.080720, 0.011620,
-    0.137700, -0.714550, 0.858360,
-    0.159010, -0.940510, 0.868720,
-    0.255160, -0.922780, 0.780100,
-    0.249400, -0.690130, 0.766030,
-    0.500560, -0.082660, 0.014630,
-    0.578910, -0.080720, 0.011620,
-    0.533590, -0.667800, 0.069910,
-    0.470130, -0.698530, 0.071610,
-    0.000000, -0.721950, 0.905100,
-    0.000000, -0.890980, 0.910750,
-    0.159010, -0.940510, 0.868720,
-    0.137700, -0.714550, 0.858360,
-    0.000000, -0.957220, 0.812550,
-    0.149380, -0.952480, 0.763790,
-    0.159010, -0.940510, 0.868720,
-    0.000000, -0.946030, 0.892890,
-    0.249400, -0.690130, 0.766030,
-    0.255160, -0.922780, 0.780100,
-    0.339310, -0.896390, 0.639950,
-    0.290390, -0.651240, 0.610830,
-    0.314440, -0.526600, 0.533780,
-    0.259740, -0.574380, 0.744420,
-    0.249400, -0.690130, 0.766030,
-    0.290390, -0.651240, 0.610830,
-    0.000000, -0.603540, 0.936870,
-    0.000000, -0.721950, 0.905100,
-    0.137700, -0.714550, 0.858360,
-    0.149670, -0.598210, 0.895060,
-    0.149670, -0.598210, 0.895060,
-    0.137700, -0.714550, 0.858360,
-    0.249400, -0.690130, 0.766030,
-    0.259740, -0.574380, 0.744420,
-    0.313680, -0.513830, 0.358140,
-    0.374100, -0.534930, 0.403380,
-    0.484710, -0.101250, 0.399450,
-    0.453220, -0.105920, 0.366360,
-    0.533590, -0.667800, 0.069910,
-    0.454090, -0.784590, 0.352820,
-    0.399590, -0.801500, 0.323810,
-    0.470130, -0.698530, 0.071610,
-    0.000000, -0.957220, 0.812550,
-    0.000000, -0.596910, 0.902200,
-    0.130140, -0.592940, 0.864480,
-    0.149380, -0.952480, 0.763790,
-    0.224890, -0.573850, 0.713340,
-    0.253420, -0.548540, 0.512670,
-    0.287870, -0.904960, 0.596760,
-    0.313680, -0.513830, 0.358140,
-    0.470130, -0.698530, 0.071610,
-    0.399590, -0.801500, 0.323810,
-    0.313680, -0.513830, 0.358140,
-    0.500560, -0.082660, 0.014630,
-    0.470130, -0.698530, 0.071610,
-    0.149130, -0.527360, 0.897980,
-    0.149670, -0.598210, 0.895060,
-    0.259740, -0.574380, 0.744420,
-    0.275770, -0.503800, 0.725070,
-    0.000000, -0.532270, 0.946800,
-    0.000000, -0.603540, 0.936870,
-    0.149670, -0.598210, 0.895060,
-    0.149130, -0.527360, 0.897980,
-    0.310980, -0.472560, 0.522290,
-    0.275770, -0.503800, 0.725070,
-    0.259740, -0.574380, 0.744420,
-    0.314440, -0.526600, 0.533780,
-    0.339310, -0.896390, 0.639950,
-    0.374100, -0.534930, 0.403380,
-    0.320110, -0.593200, 0.503670,
-    0.374100, -0.534930, 0.403380,
-    0.339310, -0.896390, 0.639950,
-    0.443090, -0.554420, 0.380540,
-    0.374100, -0.534930, 0.403380,
-    0.313680, -0.513830, 0.358140,
-    0.293530, -0.477540, 0.383260,
-    0.331080, -0.482570, 0.397450,
-    0.594770, -0.079980, 0.081700,
-    0.528950, -0.251500, 0.232890,
-    0.533590, -0.667800, 0.069910,
-    0.476200, -0.251500, 0.232890,
-    0.453220, -0.105920, 0.366360,
-    0.484710, -0.101250, 0.399450,
-    0.528950, -0.251500, 0.232890,
-    0.500560, -0.082660, 0.014630,
-    0.476200, -0.251500, 0.232890,
-    0.528950, -0.251500, 0.232890,
-    0.594770, -0.079980, 0.081700,
-    0.578910, -0.080720, 0.011620,
-    0.500560, -0.082660, 0.014630,
-    0.594770, -0.079980, 0.081700,
-    0.320110, -0.593200, 0.503670,
-    0.314440, -0.526600, 0.533780,
-    0.290390, -0.651240, 0.610830,
-    0.476200, -0.251500, 0.232890,
-    0.313680, -0.513830, 0.358140,
-    0.453220, -0.105920, 0.366360,
-    0.313680, -0.513830, 0.358140,
-    0.476200, -0.251500, 0.232890,
-    0.500560, -0.082660, 0.014630,
-    0.290390, -0.651240, 0.610830,
-    0.339310, -0.896390, 0.639950,
-    0.320110, -0.593200, 0.503670,
-    0.484710, -0.101250, 0.399450,
-    0.374100, -0.534930, 0.403380,
-    0.443090, -0.554420, 0.380540,
-    0.339310, -0.896390, 0.639950,
-    0.454090, -0.784590, 0.352820,
-    0.443090, -0.554420, 0.380540,
-    0.484710, -0.101250, 0.399450,
-    0.443090, -0.554420, 0.380540,
-    0.528950, -0.251500, 0.232890,
-    0.443090, -0.554420, 0.380540,
-    0.454090, -0.784590, 0.352820,
-    0.533590, -0.667800, 0.069910,
-    0.287870, -0.904960, 0.596760,
-    0.339310, -0.896390, 0.639950,
-    0.255160, -0.922780, 0.780100,
-    0.149380, -0.952480, 0.763790,
-    0.331080, -0.482570, 0.397450,
-    0.314440, -0.526600, 0.533780,
-    0.320110, -0.593200, 0.503670,
-    0.310980, -0.472560, 0.522290,
-    0.314440, -0.526600, 0.533780,
-    0.331080, -0.482570, 0.397450,
-    0.322370, -0.438480, 0.401690,
-    0.293530, -0.477540, 0.383260,
-    0.274830, -0.438480, 0.410680,
-    0.322370, -0.438480, 0.401690,
-    0.331080, -0.482570, 0.397450,
-    0.000000, -0.532270, 0.946800,
-    0.149130, -0.527360, 0.897980,
-    0.130140, -0.523880, 0.864480,
-    0.000000, -0.527850, 0.902200,
-    0.149130, -0.527360, 0.897980,
-    0.275770, -0.503800, 0.725070,
-    0.220590, -0.504790, 0.713340,
-    0.130140, -0.523880, 0.864480,
-    0.275770, -0.503800, 0.725070,
-    0.310980, -0.472560, 0.522290,
-    0.253420, -0.479480, 0.512670,
-    0.220590, -0.504790, 0.713340,
-    0.310980, -0.472560, 0.522290,
-    0.322370, -0.438480, 0.401690,
-    0.274830, -0.438480, 0.410680,
-    0.253420, -0.479480, 0.512670,
-    0.130140, -0.523880, 0.864480,
-    0.220590, -0.504790, 0.713340,
-    0.224890, -0.573850, 0.713340,
-    0.130140, -0.592940, 0.864480,
-    0.000000, -0.527850, 0.902200,
-    0.130140, -0.523880, 0.864480,
-    0.130140, -0.592940, 0.864480,
-    0.000000, -0.596910, 0.902200,
-    0.220590, -0.504790, 0.713340,
-    0.253420, -0.479480, 0.512670,
-    0.253420, -0.548540, 0.512670,
-    0.224890, -0.573850, 0.713340,
-    0.253420, -0.479480, 0.512670,
-    0.274830, -0.438480, 0.410680,
-    0.293530, -0.477540, 0.383260,
-    0.253420, -0.548540, 0.512670,
-    0.253420, -0.548540, 0.512670,
-    0.293530, -0.477540, 0.383260,
-    0.313680, -0.513830, 0.358140,
-    0.159010, -0.940510, 0.868720,
-    0.149380, -0.952480, 0.763790,
-    0.255160, -0.922780, 0.780100,
-    0.159010, -0.940510, 0.868720,
-    0.000000, -0.890980, 0.910750,
-    0.000000, -0.946030, 0.892890,
-    0.374100, -0.534930, 0.403380,
-    0.331080, -0.482570, 0.397450,
-    0.320110, -0.593200, 0.503670,
-    0.454090, -0.784590, 0.352820,
-    0.339310, -0.896390, 0.639950,
-    0.287870, -0.904960, 0.596760,
-    0.399590, -0.801500, 0.323810,
-    0.313680, -0.513830, 0.358140,
-    0.399590, -0.801500, 0.323810,
-    0.287870, -0.904960, 0.596760,
-    0.253420, -0.548540, 0.512670,
-    -0.528950, -0.251500, 0.232890,
-    -0.533590, -0.667800, 0.069910,
-    -0.443090, -0.554420, 0.380540,
-    -0.130140, -0.592940, 0.864480,
-    -0.149380, -0.952480, 0.763790,
-    -0.287870, -0.904960, 0.596760,
-    -0.224890, -0.573850, 0.713340,
-    -0.594770, -0.079980, 0.081700,
-    -0.578910, -0.080720, 0.011620,
-    -0.533590, -0.667800, 0.069910,
-    -0.137700, -0.714550, 0.858360,
-    -0.249400, -0.690130, 0.766030,
-    -0.255160, -0.922780, 0.780100,
-    -0.159010, -0.940510, 0.868720,
-    -0.500560, -0.082660, 0.014630,
-    -0.470130, -0.698530, 0.071610,
-    -0.533590, -0.667800, 0.069910,
-    -0.578910, -0.080720, 0.011620,
-    0.000000, -0.721950, 0.905100,
-    -0.137700, -0.714550, 0.858360,
-    -0.159010, -0.940510, 0.868720,
-    0.000000, -0.890980, 0.910750,
-    0.000000, -0.957220, 0.812550,
-    0.000000, -0.946030, 0.892890,
-    -0.159010, -0.940510, 0.868720,
-    -0.149380, -0.952480, 0.763790,
-    -0.249400, -0.690130, 0.766030,
-    -0.290390, -0.651240, 0.610830,
-    -0.339310, -0.896390, 0.639950,
-    -0.255160, -0.922780, 0.780100,
-    -0.314440, -0.526600, 0.533780,
-    -0.290390, -0.651240, 0.610830,
-    -0.249400, -0.690130, 0.766030,
-    -0.259740, -0.574380, 0.744420,
-    0.000000, -0.603540, 0.936870,
-    -0.149670, -0.598210, 0.895060,
-    -0.137700, -0.714550, 0.858360,
-    0.000000, -0.721950, 0.905100,
-    -0.149670, -0.598210, 0.895060,
-    -0.259740, -0.574380, 0.744420,
-    -0.249400, -0.690130, 0.766030,
-    -0.137700, -0.714550, 0.858360,
-    -0.313680, -0.513830, 0.358140,
-    -0.453220, -0.105920, 0.366360,
-    -0.484710, -0.101250, 0.399450,
-    -0.374100, -0.534930, 0.403380,
-    -0.399590, -0.801500, 0.323810,
-    -0.454090, -0.784590, 0.352820,
-    -0.533590, -0.667800, 0.069910,
-    -0.470130, -0.698530, 0.071610,
-    0.000000, -0.957220, 0.812550,
-    -0.149380, -0.952480, 0.763790,
-    -0.130140, -0.592940, 0.864480,
-    0.000000, -0.596910, 0.902200,
-    -0.224890, -0.573850, 0.713340,
-    -0.287870, -0.904960, 0.596760,
-    -0.253420, -0.548540, 0.512670,
-    -0.313680, -0.513830, 0.358140,
-    -0.399590, -0.801500, 0.323810,
-    -0.470130, -0.698530, 0.071610,
-    -0.313680, -0.513830, 0.358140,
-    -0.470130, -0.698530, 0.071610,
-    -0.500560, -0.082660, 0.014630,
-    -0.149130, -0.527360, 0.897980,
-    -0.275770, -0.503800, 0.725070,
-    -0.259740, -0.574380, 0.744420,
-    -0.149670, -0.598210, 0.895060,
-    0.000000, -0.532270, 0.946800,
-    -0.149130, -0.527360, 0.897980,
-    -0.149670, -0.598210, 0.895060,
-    0.000000, -0.603540, 0.936870,
-    -0.310980, -0.472560, 0.522290,
-    -0.314440, -0.526600, 0.533780,
-    -0.259740, -0.574380, 0.744420,
-    -0.275770, -0.503800, 0.725070,
-    -0.339310, -0.896390, 0.639950,
-    -0.320110, -0.593200, 0.503670,
-    -0.374100, -0.534930, 0.403380,
-    -0.374100, -0.534930, 0.403380,
-    -0.443090, -0.554420, 0.380540,
-    -0.339310, -0.896390, 0.639950,
-    -0.374100, -0.534930, 0.403380,
-    -0.331080, -0.482570, 0.397450,
-    -0.293530, -0.477540, 0.383260,
-    -0.313680, -0.513830, 0.358140,
-    -0.594770, -0.079980, 0.081700,
-    -0.533590, -0.667800, 0.069910,
-    -0.528950, -0.251500, 0.232890,
-    -0.476200, -0.251500, 0.232890,
-    -0.528950, -0.251500, 0.232890,
-    -0.484710, -0.101250, 0.399450,
-    -0.453220, -0.105920, 0.366360,
-    -0.500560, -0.082660, 0.014630,
-    -0.594770, -0.079980, 0.081700,
-    -0.528950, -0.251500, 0.232890,
-    -0.476200, -0.251500, 0.232890,
-    -0.578910, -0.080720, 0.011620,
-    -0.594770, -0.079980, 0.081700,
-    -0.500560, -0.082660, 0.014630,
-    -0.320110, -0.593200, 0.503670,
-    -0.290390, -0.651240, 0.610830,
-    -0.314440, -0.526600, 0.533780,
-    -0.476200, -0.251500, 0.232890,
-    -0.453220, -0.105920, 0.366360,
-    -0.313680, -0.513830, 0.358140,
-    -0.313680, -0.513830, 0.358140,
-    -0.500560, -0.082660, 0.014630,
-    -0.476200, -0.251500, 0.232890,
-    -0.290390, -0.651240, 0.610830,
-    -0.320110, -0.593200, 0.503670,
-    -0.339310, -0.896390, 0.639950,
-    -0.484710, -0.101250, 0.399450,
-    -0.443090, -0.554420, 0.380540,
-    -0.374100, -0.534930, 0.403380,
-    -0.339310, -0.896390, 0.639950,
-    -0.443090, -0.554420, 0.380540,
-    -0.454090, -0.784590, 0.352820,
-    -0.484710, -0.101250, 0.399450,
-    -0.528950, -0.251500, 0.232890,
-    -0.443090, -0.554420, 0.380540,
-    -0.443090, -0.554420, 0.380540,
-    -0.533590, -0.667800, 0.069910,
-    -0.454090, -0.784590, 0.352820,
-    -0.287870, -0.904960, 0.596760,
-    -0.149380, -0.952480, 0.763790,
-    -0.255160, -0.922780, 0.780100,
-    -0.339310, -0.896390, 0.639950,
-    -0.331080, -0.482570, 0.397450,
-    -0.320110, -0.593200, 0.503670,
-    -0.314440, -0.526600, 0.533780,
-    -0.310980, -0.472560, 0.522290,
-    -0.322370, -0.438480, 0.401690,
-    -0.331080, -0.482570, 0.397450,
-    -0.314440, -0.526600, 0.533780,
-    -0.293530, -0.477540, 0.383260,
-    -0.331080, -0.482570, 0.397450,
-    -0.322370, -0.438480, 0.401690,
-    -0.274830, -0.438480, 0.410680,
-    0.000000, -0.532270, 0.946800,
-    0.000000, -0.527850, 0.902200,
-    -0.130140, -0.523880, 0.864480,
-    -0.149130, -0.527360, 0.897980,
-    -0.149130, -0.527360, 0.897980,
-    -0.130140, -0.523880, 0.864480,
-    -0.220590, -0.504790, 0.713340,
-    -0.275770, -0.503800, 0.725070,
-    -0.275770, -0.503800, 0.725070,
-    -0.220590, -0.504790, 0.713340,
-    -0.253420, -0.479480, 0.512670,
-    -0.310980, -0.472560, 0.522290,
-    -0.310980, -0.472560, 0.522290,
-    -0.253420, -0.479480, 0.512670,
-    -0.274830, -0.438480, 0.410680,
-    -0.322370, -0.438480, 0.401690,
-    -0.130140, -0.523880, 0.864480,
-    -0.130140, -0.592940, 0.864480,
-    -0.224890, -0.573850, 0.713340,
-    -0.220590, -0.504790, 0.713340,
-    0.000000, -0.527850, 0.902200,
-    0.000000, -0.596910, 0.902200,
-    -0.130140, -0.592940, 0.864480,
-    -0.130140, -0.523880, 0.864480,
-    -0.220590, -0.504790, 0.713340,
-    -0.224890, -0.573850, 0.713340,
-    -0.253420, -0.548540, 0.512670,
-    -0.253420, -0.479480, 0.512670,
-    -0.253420, -0.479480, 0.512670,
-    -0.253420, -0.548540, 0.512670,
-    -0.293530, -0.477540, 0.383260,
-    -0.274830, -0.438480, 0.410680,
-    -0.253420, -0.548540, 0.512670,
-    -0.313680, -0.513830, 0.358140,
-    -0.293530, -0.477540, 0.383260,
-    -0.159010, -0.940510, 0.868720,
-    -0.255160, -0.922780, 0.780100,
-    -0.149380, -0.952480, 0.763790,
-    -0.159010, -0.940510, 0.868720,
-    0.000000, -0.946030, 0.892890,
-    0.000000, -0.890980, 0.910750,
-    -0.374100, -0.534930, 0.403380,
-    -0.320110, -0.593200, 0.503670,
-    -0.331080, -0.482570, 0.397450,
-    -0.287870, -0.904960, 0.596760,
-    -0.339310, -0.896390, 0.639950,
-    -0.454090, -0.784590, 0.352820,
-    -0.399590, -0.801500, 0.323810,
-    -0.313680, -0.513830, 0.358140,
-    -0.253420, -0.548540, 0.512670,
-    -0.287870, -0.904960, 0.596760,
-    -0.399590, -0.801500, 0.323810,
-    0.306100, 0.362790, -0.885370,
-    0.307370, 0.711510, -0.716580,
-    0.600150, 0.568630, -0.593350,
-    0.599890, 0.292720, -0.723770,
-    0.297730, 0.021430, -0.911080,
-    0.558690, 0.000000, -0.684630,
-    0.455910, -0.232160, -0.591360,
-    0.311670, -0.206040, -0.676640,
-    0.558690, 0.000000, -0.684630,
-    0.591310, -0.313280, -0.226130,
-    0.455910, -0.232160, -0.591360,
-    0.679660, 0.388500, -0.332720,
-    0.599890, 0.292720, -0.723770,
-    0.600150, 0.568630, -0.593350,
-    0.631590, 0.694170, -0.317680,
-    0.531090, 0.024920, 0.505060,
-    0.426180, 0.045370, 0.461920,
-    0.483570, 0.185970, 0.508700,
-    0.445530, -0.306890, -0.177360,
-    0.311670, -0.206040, -0.676640,
-    0.455910, -0.232160, -0.591360,
-    0.591310, -0.313280, -0.226130,
-    0.318060, 0.893270, -0.380450,
-    0.631590, 0.694170, -0.317680,
-    0.600150, 0.568630, -0.593350,
-    0.307370, 0.711510, -0.716580,
-    0.287290, 0.872620, 0.334590,
-    0.377070, 0.710650, 0.578340,
-    0.494300, 0.589190, 0.510980,
-    0.542050, 0.671160, 0.275640,
-    0.301140, 0.948070, -0.000020,
-    0.287290, 0.872620, 0.334590,
-    0.542050, 0.671160, 0.275640,
-    0.598480, 0.718420, 0.000000,
-    0.196950, -0.176730, 0.253760,
-    0.000000, -0.155730, 0.256230,
-    0.000000, -0.281450, -0.175050,
-    0.296630, -0.300450, -0.175050,
-    0.647210, 0.389610, 0.000000,
-    0.598480, 0.718420, 0.000000,
-    0.542050, 0.671160, 0.275640,
-    0.301140, 0.948070, -0.000020,
-    0.598480, 0.718420, 0.000000,
-    0.631590, 0.694170, -0.317680,
-    0.318060, 0.893270, -0.380450,
-    0.647210, 0.389610, 0.000000,
-    0.679660, 0.388500, -0.332720,
-    0.631590, 0.694170, -0.317680,
-    0.598480, 0.718420, 0.000000,
-    0.679660, 0.388500, -0.332720,
-    0.629060, -0.001120, -0.278960,
-    0.558690, 0.000000, -0.684630,
-    0.599890, 0.292720, -0.723770,
-    0.297730, 0.021430, -0.911080,
-    0.306100, 0.362790, -0.885370,
-    0.599890, 0.292720, -0.723770,
-    0.558690, 0.000000, -0.684630,
-    0.287290, 0.872620, 0.334590,
-    0.178880, 0.788180, 0.625020,
-    0.377070, 0.710650, 0.578340,
-    0.000000, -0.333010, -0.543520,
-    0.163250, -0.228350, -0.770890,
-    0.311670, -0.206040, -0.676640,
-    0.279670, -0.343070, -0.475230,
-    0.513590, 0.289090, 0.690640,
-    0.478810, 0.352680, 0.675580,
-    0.325410, 0.309890, 0.771630,
-    0.297730, 0.021430, -0.911080,
-    0.311670, -0.206040, -0.676640,
-    0.163250, -0.228350, -0.770890,
-    0.325160, -0.229480, 0.383800,
-    0.422470, -0.083520, 0.456840,
-    0.332500, -0.285900, 0.583760,
-    0.671240, 0.001010, 0.200700,
-    0.649340, 0.001890, 0.315570,
-    0.610270, -0.115140, 0.434580,
-    0.644470, -0.088890, 0.184820,
-    0.610270, -0.115140, 0.434580,
-    0.583460, 0.024460, 0.514410,
-    0.551330, 0.021730, 0.589190,
-    0.621460, -0.063160, 0.028470,
-    0.579800, -0.080130, 0.048600,
-    0.501830, -0.087230, -0.064250,
-    0.610270, -0.115140, 0.434580,
-    0.467540, -0.277280, 0.576690,
-    0.522910, -0.087920, 0.455800,
-    0.155770, -0.437410, 0.886730,
-    0.000000, -0.435240, 0.966820,
-    0.000000, -0.525980, 0.958480,
-    0.161350, -0.524330, 0.894180,
-    0.621460, -0.063160, 0.028470,
-    0.644470, -0.088890, 0.184820,
-    0.607490, -0.108590, 0.216590,
-    0.579800, -0.080130, 0.048600,
-    0.000000, 0.106340, 0.938250,
-    0.080090, 0.040600, 0.851780,
-    0.062370, 0.183910, 0.830680,
-    0.000000, 0.185520, 0.858640,
-    0.268540, -0.414500, 0.719050,
-    0.155770, -0.437410, 0.886730,
-    0.161350, -0.524330, 0.894180,
-    0.278240, -0.501180, 0.732020,
-    0.000000, -0.231800, 0.977090,
-    0.000000, -0.324820, 0.952790,
-    0.155510, -0.209040, 0.872040,
-    0.000000, 0.410130, -0.960990,
-    0.000000, 0.768350, -0.794220,
-    0.307370, 0.711510, -0.716580,
-    0.306100, 0.362790, -0.885370,
-    0.000000, -0.023090, -0.976580,
-    0.297730, 0.021430, -0.911080,
-    0.163250, -0.228350, -0.770890,
-    0.000000, -0.216590, -0.798130,
-    0.000000, 0.314070, 0.882900,
-    0.196080, 0.410900, 0.861420,
-    0.178880, 0.788180, 0.625020,
-    0.000000, 0.815040, 0.665280,
-    0.000000, -0.333010, -0.543520,
-    0.000000, -0.216590, -0.798130,
-    0.163250, -0.228350, -0.770890,
-    0.000000, 0.972370, -0.435960,
-    0.318060, 0.893270, -0.380450,
-    0.307370, 0.711510, -0.716580,
-    0.000000, 0.768350, -0.794220,
-    0.000000, 0.950540, 0.376380,
-    0.000000, 0.815040, 0.665280,
-    0.178880, 0.788180, 0.625020,
-    0.287290, 0.872620, 0.334590,
-    0.000000, 1.030890, 0.000000,
-    0.000000, 0.950540, 0.376380,
-    0.287290, 0.872620, 0.334590,
-    0.301140, 0.948070, -0.000020,
-    0.000000, 1.030890, 0.000000,
-    0.301140, 0.948070, -0.000020,
-    0.318060, 0.893270, -0.380450,
-    0.000000, 0.972370, -0.435960,
-    0.000000, 0.314070, 0.882900,
-    0.136020, 0.289880, 0.866910,
-    0.196080, 0.410900, 0.861420,
-    0.000000, -0.023090, -0.976580,
-    0.000000, 0.410130, -0.960990,
-    0.306100, 0.362790, -0.885370,
-    0.297730, 0.021430, -0.911080,
-    0.279670, -0.343070, -0.475230,
-    0.296630, -0.300450, -0.175050,
-    0.000000, -0.281450, -0.175050,
-    0.000000, -0.333010, -0.543520,
-    0.279670, -0.343070, -0.475230,
-    0.445530, -0.306890, -0.177360,
-    0.296630, -0.300450, -0.175050,
-    0.279670, -0.343070, -0.475230,
-    0.311670, -0.206040, -0.676640,
-    0.445530, -0.306890, -0.177360,
-    0.583460, 0.024460, 0.514410,
-    0.649340, 0.001890, 0.315570,
-    0.585430, -0.004430, 0.410960,
-    0.136020, 0.289880, 0.866910,
-    0.062370, 0.183910, 0.830680,
-    0.139350, 0.248770, 0.781540,
-    0.080090, 0.040600, 0.851780,
-    0.000000, 0.106340, 0.938250,
-    0.155510, -0.209040, 0.872040,
-    0.531000, 0.159460, 0.628180,
-    0.551330, 0.021730, 0.589190,
-    0.583460, 0.024460, 0.514410,
-    0.539220, 0.208810, 0.604030,
-    0.268540, -0.414500, 0.719050,
-    0.317310, -0.391620, 0.535720,
-    0.332500, -0.285900, 0.583760,
-    0.302600, -0.242410, 0.683810,
-    0.614030, 0.000120, -0.000090,
-    0.671240, 0.001010, 0.200700,
-    0.644470, -0.088890, 0.184820,
-    0.621460, -0.063160, 0.028470,
-    0.614030, 0.000120, -0.000090,
-    0.629060, -0.001120, -0.278960,
-    0.590790, 0.033320, 0.008110,
-    0.524240, 0.250530, 0.314880,
-    0.545310, 0.052650, 0.198200,
-    0.647210, 0.389610, 0.000000,
-    0.603990, -0.061080, -0.196340,
-    0.621460, -0.063160, 0.028470,
-    0.501830, -0.087230, -0.064250,
-    0.629060, -0.001120, -0.278960,
-    0.603990, -0.061080, -0.196340,
-    0.591310, -0.313280, -0.226130,
-    0.591310, -0.313280, -0.226130,
-    0.603990, -0.061080, -0.196340,
-    0.501830, -0.087230, -0.064250,
-    0.591310, -0.313280, -0.226130,
-    0.501830, -0.087230, -0.064250,
-    0.445530, -0.306890, -0.177360,
-    0.558690, 0.000000, -0.684630,
-    0.629060, -0.001120, -0.278960,
-    0.591310, -0.313280, -0.226130,
-    0.218320, 0.119180, 0.550370,
-    0.531000, 0.159460, 0.628180,
-    0.506450, 0.251750, 0.703060,
-    0.000000, 0.185520, 0.858640,
-    0.062370, 0.183910, 0.830680,
-    0.136020, 0.289880, 0.866910,
-    0.000000, 0.314070, 0.882900,
-    0.218320, 0.119180, 0.550370,
-    0.506450, 0.251750, 0.703060,
-    0.325410, 0.309890, 0.771630,
-    0.062370, 0.183910, 0.830680,
-    0.080090, 0.040600, 0.851780,
-    0.104650, 0.058610, 0.805920,
-    0.489400, -0.043810, 0.182250,
-    0.501830, -0.087230, -0.064250,
-    0.579800, -0.080130, 0.048600,
-    0.513590, 0.289090, 0.690640,
-    0.539220, 0.208810, 0.604030,
-    0.483570, 0.185970, 0.508700,
-    0.317310, -0.391620, 0.535720,
-    0.312870, -0.469740, 0.520600,
-    0.326840, -0.432710, 0.398820,
-    0.331390, -0.353320, 0.395430,
-    0.332500, -0.285900, 0.583760,
-    0.317310, -0.391620, 0.535720,
-    0.331390, -0.353320, 0.395430,
-    0.325160, -0.229480, 0.383800,
-    0.278240, -0.501180, 0.732020,
-    0.312870, -0.469740, 0.520600,
-    0.317310, -0.391620, 0.535720,
-    0.268540, -0.414500, 0.719050,
-    0.302600, -0.242410, 0.683810,
-    0.155510, -0.209040, 0.872040,
-    0.155770, -0.437410, 0.886730,
-    0.268540, -0.414500, 0.719050,
-    0.155510, -0.209040, 0.872040,
-    0.000000, -0.324820, 0.952790,
-    0.000000, -0.435240, 0.966820,
-    0.155770, -0.437410, 0.886730,
-    0.531000, 0.159460, 0.628180,
-    0.218320, 0.119180, 0.550370,
-    0.509600, 0.041210, 0.621820,
-    0.155510, -0.209040, 0.872040,
-    0.000000, 0.106340, 0.938250,
-    0.000000, -0.221290, 0.831740,
-    0.000000, -0.231800, 0.977090,
-    0.155510, -0.209040, 0.872040,
-    0.000000, -0.221290, 0.831740,
-    0.325410, 0.309890, 0.771630,
-    0.136020, 0.289880, 0.866910,
-    0.139350, 0.248770, 0.781540,
-    0.062370, 0.183910, 0.830680,
-    0.084830, 0.092980, 0.730790,
-    0.139350, 0.248770, 0.781540,
-    0.325410, 0.309890, 0.771630,
-    0.139350, 0.248770, 0.781540,
-    0.218320, 0.119180, 0.550370,
-    0.509600, 0.041210, 0.621820,
-    0.218320, 0.119180, 0.550370,
-    0.255630, -0.009010, 0.770000,
-    0.441340, -0.007760, 0.683470,
-    0.255630, -0.009010, 0.770000,
-    0.227640, -0.073920, 0.776070,
-    0.441340, -0.007760, 0.683470,
-    0.302600, -0.242410, 0.683810,
-    0.227640, -0.073920, 0.776070,
-    0.155510, -0.209040, 0.872040,
-    0.227640, -0.073920, 0.776070,
-    0.255630, -0.009010, 0.770000,
-    0.080090, 0.040600, 0.851780,
-    0.441340, -0.007760, 0.683470,
-    0.227640, -0.073920, 0.776070,
-    0.302600, -0.242410, 0.683810,
-    0.467540, -0.277280, 0.576690,
-    0.614030, 0.000120, -0.000090,
-    0.621460, -0.063160, 0.028470,
-    0.603990, -0.061080, -0.196340,
-    0.629060, -0.001120, -0.278960,
-    0.531090, 0.024920, 0.505060,
-    0.583460, 0.024460, 0.514410,
-    0.585430, -0.004430, 0.410960,
-    0.542050, 0.671160, 0.275640,
-    0.494300, 0.589190, 0.510980,
-    0.524240, 0.250530, 0.314880,
-    0.610270, -0.115140, 0.434580,
-    0.649340, 0.001890, 0.315570,
-    0.583460, 0.024460, 0.514410,
-    0.494300, 0.589190, 0.510980,
-    0.478810, 0.352680, 0.675580,
-    0.483570, 0.185970, 0.508700,
-    0.524240, 0.250530, 0.314880,
-    0.302600, -0.242410, 0.683810,
-    0.332500, -0.285900, 0.583760,
-    0.467540, -0.277280, 0.576690,
-    0.644470, -0.088890, 0.184820,
-    0.610270, -0.115140, 0.434580,
-    0.522910, -0.087920, 0.455800,
-    0.607490, -0.108590, 0.216590,
-    0.501830, -0.087230, -0.064250,
-    0.415500, -0.123990, 0.123720,
-    0.445530, -0.306890, -0.177360,
-    0.426180, 0.045370, 0.461920,
-    0.273910, -0.118180, 0.323690,
-    0.343340, -0.053960, 0.311700,
-    0.426180, 0.045370, 0.461920,
-    0.531090, 0.024920, 0.505060,
-    0.422470, -0.083520, 0.456840,
-    0.585430, -0.004430, 0.410960,
-    0.624980, -0.006860, 0.223080,
-    0.607490, -0.108590, 0.216590,
-    0.522910, -0.087920, 0.455800,
-    0.531090, 0.024920, 0.505060,
-    0.585430, -0.004430, 0.410960,
-    0.522910, -0.087920, 0.455800,
-    0.590790, 0.033320, 0.008110,
-    0.545310, 0.052650, 0.198200,
-    0.489400, -0.043810, 0.182250,
-    0.579800, -0.080130, 0.048600,
-    0.624980, -0.006860, 0.223080,
-    0.590790, 0.033320, 0.008110,
-    0.579800, -0.080130, 0.048600,
-    0.607490, -0.108590, 0.216590,
-    0.671240, 0.001010, 0.200700,
-    0.624980, -0.006860, 0.223080,
-    0.585430, -0.004430, 0.410960,
-    0.649340, 0.001890, 0.315570,
-    0.614030, 0.000120, -0.000090,
-    0.590790, 0.033320, 0.008110,
-    0.624980, -0.006860, 0.223080,
-    0.671240, 0.001010, 0.200700,
-    0.545310, 0.052650, 0.198200,
-    0.590790, 0.033320, 0.008110,
-    0.647210, 0.389610, 0.000000,
-    0.478810, 0.352680, 0.675580,
-    0.513590, 0.289090, 0.690640,
-    0.483570, 0.185970, 0.508700,
-    0.422470, -0.083520, 0.456840,
-    0.325160, -0.229480, 0.383800,
-    0.273910, -0.118180, 0.323690,
-    0.139350, 0.248770, 0.781540,
-    0.084830, 0.092980, 0.730790,
-    0.218320, 0.119180, 0.550370,
-    0.422470, -0.083520, 0.456840,
-    0.522910, -0.087920, 0.455800,
-    0.467540, -0.277280, 0.576690,
-    0.332500, -0.285900, 0.583760,
-    0.155510, -0.209040, 0.872040,
-    0.227640, -0.073920, 0.776070,
-    0.080090, 0.040600, 0.851780,
-    0.255630, -0.009010, 0.770000,
-    0.218320, 0.119180, 0.550370,
-    0.084830, 0.092980, 0.730790,
-    0.255630, -0.009010, 0.770000,
-    0.084830, 0.092980, 0.730790,
-    0.104650, 0.058610, 0.805920,
-    0.080090, 0.040600, 0.851780,
-    0.255630, -0.009010, 0.770000,
-    0.104650, 0.058610, 0.805920,
-    0.084830, 0.092980, 0.730790,
-    0.062370, 0.183910, 0.830680,
-    0.104650, 0.058610, 0.805920,
-    0.629060, -0.001120, -0.278960,
-    0.679660, 0.388500, -0.332720,
-    0.647210, 0.389610, 0.000000,
-    0.590790, 0.033320, 0.008110,
-    0.524240, 0.250530, 0.314880,
-    0.647210, 0.389610, 0.000000,
-    0.542050, 0.671160, 0.275640,
-    0.489400, -0.043810, 0.182250,
-    0.343340, -0.053960, 0.311700,
-    0.415500, -0.123990, 0.123720,
-    0.501830, -0.087230, -0.064250,
-    0.489400, -0.043810, 0.182250,
-    0.415500, -0.123990, 0.123720,
-    0.583460, 0.024460, 0.514410,
-    0.531090, 0.024920, 0.505060,
-    0.483570, 0.185970, 0.508700,
-    0.539220, 0.208810, 0.604030,
-    0.325410, 0.309890, 0.771630,
-    0.506450, 0.251750, 0.703060,
-    0.513590, 0.289090, 0.690640,
-    0.422470, -0.083520, 0.456840,
-    0.531090, 0.024920, 0.505060,
-    0.522910, -0.087920, 0.455800,
-    0.531000, 0.159460, 0.628180,
-    0.509600, 0.041210, 0.621820,
-    0.551330, 0.021730, 0.589190,
-    0.551330, 0.021730, 0.589190,
-    0.509600, 0.041210, 0.621820,
-    0.441340, -0.007760, 0.683470,
-    0.467540, -0.277280, 0.576690,
-    0.610270, -0.115140, 0.434580,
-    0.551330, 0.021730, 0.589190,
-    0.467540, -0.277280, 0.576690,
-    0.551330, 0.021730, 0.589190,
-    0.441340, -0.007760, 0.683470,
-    0.273910, -0.118180, 0.323690,
-    0.426180, 0.045370, 0.461920,
-    0.422470, -0.083520, 0.456840,
-    0.426180, 0.045370, 0.461920,
-    0.343340, -0.053960, 0.311700,
-    0.524240, 0.250530, 0.314880,
-    0.483570, 0.185970, 0.508700,
-    0.489400, -0.043810, 0.182250,
-    0.545310, 0.052650, 0.198200,
-    0.343340, -0.053960, 0.311700,
-    0.343340, -0.053960, 0.311700,
-    0.545310, 0.052650, 0.198200,
-    0.524240, 0.250530, 0.314880,
-    0.343340, -0.053960, 0.311700,
-    0.273910, -0.118180, 0.323690,
-    0.415500, -0.123990, 0.123720,
-    0.196950, -0.176730, 0.253760,
-    0.415500, -0.123990, 0.123720,
-    0.273910, -0.118180, 0.323690,
-    0.325160, -0.229480, 0.383800,
-    0.196950, -0.176730, 0.253760,
-    0.273910, -0.118180, 0.323690,
-    0.415500, -0.123990, 0.123720,
-    0.196950, -0.176730, 0.253760,
-    0.296630, -0.300450, -0.175050,
-    0.445530, -0.306890, -0.177360,
-    0.325160, -0.229480, 0.383800,
-    0.331390, -0.353320, 0.395430,
-    0.196950, -0.176730, 0.253760,
-    0.240090, -0.347070, 0.396100,
-    0.196950, -0.176730, 0.253760,
-    0.331390, -0.353320, 0.395430,
-    0.261780, -0.432710, 0.398820,
-    0.240090, -0.347070, 0.396100,
-    0.331390, -0.353320, 0.395430,
-    0.326840, -0.432710, 0.398820,
-    0.196080, 0.410900, 0.861420,
-    0.136020, 0.289880, 0.866910,
-    0.325410, 0.309890, 0.771630,
-    0.478810, 0.352680, 0.675580,
-    0.196080, 0.410900, 0.861420,
-    0.325410, 0.309890, 0.771630,
-    0.494300, 0.589190, 0.510980,
-    0.377070, 0.710650, 0.578340,
-    0.478810, 0.352680, 0.675580,
-    0.278240, -0.501180, 0.732020,
-    0.161350, -0.524330, 0.894180,
-    0.128000, -0.516250, 0.866500,
-    0.227270, -0.496280, 0.711580,
-    0.161350, -0.524330, 0.894180,
-    0.000000, -0.525980, 0.958480,
-    0.000000, -0.524830, 0.902040,
-    0.128000, -0.516250, 0.866500,
-    0.326840, -0.432710, 0.398820,
-    0.312870, -0.469740, 0.520600,
-    0.255000, -0.461810, 0.501250,
-    0.261780, -0.432710, 0.398820,
-    0.312870, -0.469740, 0.520600,
-    0.278240, -0.501180, 0.732020,
-    0.227270, -0.496280, 0.711580,
-    0.255000, -0.461810, 0.501250,
-    0.255000, -0.461810, 0.501250,
-    0.227270, -0.496280, 0.711580,
-    0.227270, -0.405860, 0.711580,
-    0.255000, -0.371390, 0.501250,
-    0.128000, -0.516250, 0.866500,
-    0.000000, -0.524830, 0.902040,
-    0.000000, -0.434400, 0.902040,
-    0.128000, -0.425830, 0.866500,
-    0.227270, -0.496280, 0.711580,
-    0.128000, -0.516250, 0.866500,
-    0.128000, -0.425830, 0.866500,
-    0.227270, -0.405860, 0.711580,
-    0.261780, -0.432710, 0.398820,
-    0.255000, -0.461810, 0.501250,
-    0.255000, -0.371390, 0.501250,
-    0.240090, -0.347070, 0.396100,
-    0.240090, -0.347070, 0.396100,
-    0.255000, -0.371390, 0.501250,
-    0.173500, -0.246610, 0.469090,
-    0.128000, -0.425830, 0.866500,
-    0.000000, -0.434400, 0.902040,
-    0.000000, -0.334970, 0.838360,
-    0.076130, -0.327980, 0.809410,
-    0.255000, -0.371390, 0.501250,
-    0.227270, -0.405860, 0.711580,
-    0.139430, -0.311720, 0.683230,
-    0.173500, -0.246610, 0.469090,
-    0.227270, -0.405860, 0.711580,
-    0.128000, -0.425830, 0.866500,
-    0.076130, -0.327980, 0.809410,
-    0.139430, -0.311720, 0.683230,
-    0.173500, -0.246610, 0.469090,
-    0.139430, -0.311720, 0.683230,
-    0.000000, -0.236670, 0.678330,
-    0.000000, -0.206240, 0.464180,
-    0.139430, -0.311720, 0.683230,
-    0.076130, -0.327980, 0.809410,
-    0.000000, -0.236670, 0.678330,
-    0.076130, -0.327980, 0.809410,
-    0.000000, -0.334970, 0.838360,
-    0.000000, -0.236670, 0.678330,
-    0.240090, -0.347070, 0.396100,
-    0.173500, -0.246610, 0.469090,
-    0.196950, -0.176730, 0.253760,
-    0.196950, -0.176730, 0.253760,
-    0.173500, -0.246610, 0.469090,
-    0.000000, -0.206240, 0.464180,
-    0.000000, -0.155730, 0.256230,
-    0.539220, 0.208810, 0.604030,
-    0.513590, 0.289090, 0.690640,
-    0.506450, 0.251750, 0.703060,
-    0.531000, 0.159460, 0.628180,
-    0.196080, 0.410900, 0.861420,
-    0.478810, 0.352680, 0.675580,
-    0.377070, 0.710650, 0.578340,
-    0.178880, 0.788180, 0.625020,
-    0.196080, 0.410900, 0.861420,
-    0.377070, 0.710650, 0.578340,
-    -0.306100, 0.362790, -0.885370,
-    -0.599890, 0.292720, -0.723770,
-    -0.600150, 0.568630, -0.593350,
-    -0.307370, 0.711510, -0.716580,
-    -0.297730, 0.021430, -0.911080,
-    -0.311670, -0.206040, -0.676640,
-    -0.455910, -0.232160, -0.591360,
-    -0.558690, 0.000000, -0.684630,
-    -0.558690, 0.000000, -0.684630,
-    -0.455910, -0.232160, -0.591360,
-    -0.591310, -0.313280, -0.226130,
-    -0.679660, 0.388500, -0.332720,
-    -0.631590, 0.694170, -0.317680,
-    -0.600150, 0.568630, -0.593350,
-    -0.599890, 0.292720, -0.723770,
-    -0.531090, 0.024920, 0.505060,
-    -0.483570, 0.185970, 0.508700,
-    -0.426180, 0.045370, 0.461920,
-    -0.445530, -0.306890, -0.177360,
-    -0.591310, -0.313280, -0.226130,
-    -0.455910, -0.232160, -0.591360,
-    -0.311670, -0.206040, -0.676640,
-    -0.318060, 0.893270, -0.380450,
-    -0.307370, 0.711510, -0.716580,
-    -0.600150, 0.568630, -0.593350,
-    -0.631590, 0.694170, -0.317680,
-    -0.287290, 0.872620, 0.334590,
-    -0.542050, 0.671160, 0.275640,
-    -0.494300, 0.589190, 0.510980,
-    -0.377070, 0.710650, 0.578340,
-    -0.301140, 0.948070, -0.000020,
-    -0.598480, 0.718420, 0.000000,
-    -0.542050, 0.671160, 0.275640,
-    -0.287290, 0.872620, 0.334590,
-    -0.196950, -0.176730, 0.253760,
-    -0.296630, -0.300450, -0.175050,
-    0.000000, -0.281450, -0.175050,
-    0.000000, -0.155730, 0.256230,
-    -0.647210, 0.389610, 0.000000,
-    -0.542050, 0.671160, 0.275640,
-    -0.598480, 0.718420, 0.000000,
-    -0.301140, 0.948070, -0.000020,
-    -0.318060, 0.893270, -0.380450,
-    -0.631590, 0.694170, -0.317680,
-    -0.598480, 0.718420, 0.000000,
-    -0.647210, 0.389610, 0.000000,
-    -0.598480, 0.718420, 0.000000,
-    -0.631590, 0.694170, -0.317680,
-    -0.679660, 0.388500, -0.332720,
-    -0.679660, 0.388500, -0.332720,
-    -0.599890, 0.292720, -0.723770,
-    -0.558690, 0.000000, -0.684630,
-    -0.629060, -0.001120, -0.278960,
-    -0.297730, 0.021430, -0.911080,
-    -0.558690, 0.000000, -0.684630,
-    -0.599890, 0.292720, -0.723770,
-    -0.306100, 0.362790, -0.885370,
-    -0.287290, 0.872620, 0.334590,
-    -0.377070, 0.710650, 0.578340,
-    -0.178880, 0.788180, 0.625020,
-    0.000000, -0.333010, -0.543520,
-    -0.279670, -0.343070, -0.475230,
-    -0.311670, -0.206040, -0.676640,
-    -0.163250, -0.228350, -0.770890,
-    -0.513590, 0.289090, 0.690640,
-    -0.325410, 0.309890, 0.771630,
-    -0.478810, 0.352680, 0.675580,
-    -0.297730, 0.021430, -0.911080,
-    -0.163250, -0.228350, -0.770890,
-    -0.311670, -0.206040, -0.676640,
-    -0.325160, -0.229480, 0.383800,
-    -0.332500, -0.285900, 0.583760,
-    -0.422470, -0.083520, 0.456840,
-    -0.671240, 0.001010, 0.200700,
-    -0.644470, -0.088890, 0.184820,
-    -0.610270, -0.115140, 0.434580,
-    -0.649340, 0.001890, 0.315570,
-    -0.610270, -0.115140, 0.434580,
-    -0.551330, 0.021730, 0.589190,
-    -0.583460, 0.024460, 0.514410,
-    -0.621460, -0.063160, 0.028470,
-    -0.501830, -0.087230, -0.064250,
-    -0.579800, -0.080130, 0.048600,
-    -0.610270, -0.115140, 0.434580,
-    -0.522910, -0.087920, 0.455800,
-    -0.467540, -0.277280, 0.576690,
-    -0.155770, -0.437410, 0.886730,
-    -0.161350, -0.524330, 0.894180,
-    0.000000, -0.525980, 0.958480,
-    0.000000, -0.435240, 0.966820,
-    -0.621460, -0.063160, 0.028470,
-    -0.579800, -0.080130, 0.048600,
-    -0.607490, -0.108590, 0.216590,
-    -0.644470, -0.088890, 0.184820,
-    0.000000, 0.106340, 0.938250,
-    0.000000, 0.185520, 0.858640,
-    -0.062370, 0.183910, 0.830680,
-    -0.080090, 0.040600, 0.851780,
-    -0.268540, -0.414500, 0.719050,
-    -0.278240, -0.501180, 0.732020,
-    -0.161350, -0.524330, 0.894180,
-    -0.155770, -0.437410, 0.886730,
-    0.000000, -0.231800, 0.977090,
-    -0.155510, -0.209040, 0.872040,
-    0.000000, -0.324820, 0.952790,
-    0.000000, 0.410130, -0.960990,
-    -0.306100, 0.362790, -0.885370,
-    -0.307370, 0.711510, -0.716580,
-    0.000000, 0.768350, -0.794220,
-    0.000000, -0.023090, -0.976580,
-    0.000000, -0.216590, -0.798130,
-    -0.163250, -0.228350, -0.770890,
-    -0.297730, 0.021430, -0.911080,
-    0.000000, 0.314070, 0.882900,
-    0.000000, 0.815040, 0.665280,
-    -0.178880, 0.788180, 0.625020,
-    -0.196080, 0.410900, 0.861420,
-    0.000000, -0.333010, -0.543520,
-    -0.163250, -0.228350, -0.770890,
-    0.000000, -0.216590, -0.798130,
-    0.000000, 0.972370, -0.435960,
-    0.000000, 0.768350, -0.794220,
-    -0.307370, 0.711510, -0.716580,
-    -0.318060, 0.893270, -0.380450,
-    0.000000, 0.950540, 0.376380,
-    -0.287290, 0.872620, 0.334590,
-    -0.178880, 0.788180, 0.625020,
-    0.000000, 0.815040, 0.665280,
-    0.000000, 1.030890, 0.000000,
-    -0.301140, 0.948070, -0.000020,
-    -0.287290, 0.872620, 0.334590,
-    0.000000, 0.950540, 0.376380,
-    0.000000, 1.030890, 0.000000,
-    0.000000, 0.972370, -0.435960,
-    -0.318060, 0.893270, -0.380450,
-    -0.301140, 0.948070, -0.000020,
-    0.000000, 0.314070, 0.882900,
-    -0.196080, 0.410900, 0.861420,
-    -0.136020, 0.289880, 0.866910,
-    0.000000, -0.023090, -0.976580,
-    -0.297730, 0.021430, -0.911080,
-    -0.306100, 0.362790, -0.885370,
-    0.000000, 0.410130, -0.960990,
-    -0.279670, -0.343070, -0.475230,
-    0.000000, -0.333010, -0.543520,
-    0.000000, -0.281450, -0.175050,
-    -0.296630, -0.300450, -0.175050,
-    -0.279670, -0.343070, -0.475230,
-    -0.296630, -0.300450, -0.175050,
-    -0.445530, -0.306890, -0.177360,
-    -0.279670, -0.343070, -0.475230,
-    -0.445530, -0.306890, -0.177360,
-    -0.311670, -0.206040, -0.676640,
-    -0.583460, 0.024460, 0.514410,
-    -0.585430, -0.004430, 0.410960,
-    -0.649340, 0.001890, 0.315570,
-    -0.136020, 0.289880, 0.866910,
-    -0.139350, 0.248770, 0.781540,
-    -0.062370, 0.183910, 0.830680,
-    -0.080090, 0.040600, 0.851780,
-    -0.155510, -0.209040, 0.872040,
-    0.000000, 0.106340, 0.938250,
-    -0.531000, 0.159460, 0.628180,
-    -0.539220, 0.208810, 0.604030,
-    -0.583460, 0.024460, 0.514410,
-    -0.551330, 0.021730, 0.589190,
-    -0.268540, -0.414500, 0.719050,
-    -0.302600, -0.242410, 0.683810,
-    -0.332500, -0.285900, 0.583760,
-    -0.317310, -0.391620, 0.535720,
-    -0.614030, 0.000120, -0.000090,
-    -0.621460, -0.063160, 0.028470,
-    -0.644470, -0.088890, 0.184820,
-    -0.671240, 0.001010, 0.200700,
-    -0.614030, 0.000120, -0.000090,
-    -0.590790, 0.033320, 0.008110,
-    -0.629060, -0.001120, -0.278960,
-    -0.524240, 0.250530, 0.314880,
-    -0.647210, 0.389610, 0.000000,
-    -0.545310, 0.052650, 0.198200,
-    -0.603990, -0.061080, -0.196340,
-    -0.501830, -0.087230, -0.064250,
-    -0.621460, -0.063160, 0.028470,
-    -0.629060, -0.001120, -0.278960,
-    -0.591310, -0.313280, -0.226130,
-    -0.603990, -0.061080, -0.196340,
-    -0.591310, -0.313280, -0.226130,
-    -0.501830, -0.087230, -0.064250,
-    -0.603990, -0.061080, -0.196340,
-    -0.591310, -0.313280, -0.226130,
-    -0.445530, -0.306890, -0.177360,
-    -0.501830, -0.087230, -0.064250,
-    -0.558690, 0.000000, -0.684630,
-    -0.591310, -0.313280, -0.226130,
-    -0.629060, -0.001120, -0.278960,
-    -0.218320, 0.119180, 0.550370,
-    -0.506450, 0.251750, 0.703060,
-    -0.531000, 0.159460, 0.628180,
-    0.000000, 0.185520, 0.858640,
-    0.000000, 0.314070, 0.882900,
-    -0.136020, 0.289880, 0.866910,
-    -0.062370, 0.183910, 0.830680,
-    -0.218320, 0.119180, 0.550370,
-    -0.325410, 0.309890, 0.771630,
-    -0.506450, 0.251750, 0.703060,
-    -0.062370, 0.183910, 0.830680,
-    -0.104650, 0.058610, 0.805920,
-    -0.080090, 0.040600, 0.851780,
-    -0.489400, -0.043810, 0.182250,
-    -0.579800, -0.080130, 0.048600,
-    -0.501830, -0.087230, -0.064250,
-    -0.513590, 0.289090, 0.690640,
-    -0.483570, 0.185970, 0.508700,
-    -0.539220, 0.208810, 0.604030,
-    -0.317310, -0.391620, 0.535720,
-    -0.331390, -0.353320, 0.395430,
-    -0.326840, -0.432710, 0.398820,
-    -0.312870, -0.469740, 0.520600,
-    -0.332500, -0.285900, 0.583760,
-    -0.325160, -0.229480, 0.383800,
-    -0.331390, -0.353320, 0.395430,
-    -0.317310, -0.391620, 0.535720,
-    -0.278240, -0.501180, 0.732020,
-    -0.268540, -0.414500, 0.719050,
-    -0.317310, -0.391620, 0.535720,
-    -0.312870, -0.469740, 0.520600,
-    -0.302600, -0.242410, 0.683810,
-    -0.268540, -0.414500, 0.719050,
-    -0.155770, -0.437410, 0.886730,
-    -0.155510, -0.209040, 0.872040,
-    -0.155510, -0.209040, 0.872040,
-    -0.155770, -0.437410, 0.886730,
-    0.000000, -0.435240, 0.966820,
-    0.000000, -0.324820, 0.952790,
-    -0.531000, 0.159460, 0.628180,
-    -0.509600, 0.041210, 0.621820,
-    -0.218320, 0.119180, 0.550370,
-    -0.155510, -0.209040, 0.872040,
-    0.000000, -0.221290, 0.831740,
-    0.000000, 0.106340, 0.938250,
-    0.000000, -0.231800, 0.977090,
-    0.000000, -0.221290, 0.831740,
-    -0.155510, -0.209040, 0.872040,
-    -0.325410, 0.309890, 0.771630,
-    -0.139350, 0.248770, 0.781540,
-    -0.136020, 0.289880, 0.866910,
-    -0.062370, 0.183910, 0.830680,
-    -0.139350, 0.248770, 0.781540,
-    -0.084830, 0.092980, 0.730790,
-    -0.325410, 0.309890, 0.771630,
-    -0.218320, 0.119180, 0.550370,
-    -0.139350, 0.248770, 0.781540,
-    -0.509600, 0.041210, 0.621820,
-    -0.441340, -0.007760, 0.683470,
-    -0.255630, -0.009010, 0.770000,
-    -0.218320, 0.119180, 0.550370,
-    -0.255630, -0.009010, 0.770000,
-    -0.441340, -0.007760, 0.683470,
-    -0.227640, -0.073920, 0.776070,
-    -0.302600, -0.242410, 0.683810,
-    -0.155510, -0.209040, 0.872040,
-    -0.227640, -0.073920, 0.776070,
-    -0.227640, -0.073920, 0.776070,
-    -0.080090, 0.040600, 0.851780,
-    -0.255630, -0.009010, 0.770000,
-    -0.441340, -0.007760, 0.683470,
-    -0.467540, -0.277280, 0.576690,
-    -0.302600, -0.242410, 0.683810,
-    -0.227640, -0.073920, 0.776070,
-    -0.603990, -0.061080, -0.196340,
-    -0.621460, -0.063160, 0.028470,
-    -0.614030, 0.000120, -0.000090,
-    -0.629060, -0.001120, -0.278960,
-    -0.531090, 0.024920, 0.505060,
-    -0.585430, -0.004430, 0.410960,
-    -0.583460, 0.024460, 0.514410,
-    -0.542050, 0.671160, 0.275640,
-    -0.524240, 0.250530, 0.314880,
-    -0.494300, 0.589190, 0.510980,
-    -0.610270, -0.115140, 0.434580,
-    -0.583460, 0.024460, 0.514410,
-    -0.649340, 0.001890, 0.315570,
-    -0.494300, 0.589190, 0.510980,
-    -0.524240, 0.250530, 0.314880,
-    -0.483570, 0.185970, 0.508700,
-    -0.478810, 0.352680, 0.675580,
-    -0.302600, -0.242410, 0.683810,
-    -0.467540, -0.277280, 0.576690,
-    -0.332500, -0.285900, 0.583760,
-    -0.644470, -0.088890, 0.184820,
-    -0.607490, -0.108590, 0.216590,
-    -0.522910, -0.087920, 0.455800,
-    -0.610270, -0.115140, 0.434580,
-    -0.501830, -0.087230, -0.064250,
-    -0.445530, -0.306890, -0.177360,
-    -0.415500, -0.123990, 0.123720,
-    -0.426180, 0.045370, 0.461920,
-    -0.343340, -0.053960, 0.311700,
-    -0.273910, -0.118180, 0.323690,
-    -0.426180, 0.045370, 0.461920,
-    -0.422470, -0.083520, 0.456840,
-    -0.531090, 0.024920, 0.505060,
-    -0.585430, -0.004430, 0.410960,
-    -0.522910, -0.087920, 0.455800,
-    -0.607490, -0.108590, 0.216590,
-    -0.624980, -0.006860, 0.223080,
-    -0.531090, 0.024920, 0.505060,
-    -0.522910, -0.087920, 0.455800,
-    -0.585430, -0.004430, 0.410960,
-    -0.590790, 0.033320, 0.008110,
-    -0.579800, -0.080130, 0.048600,
-    -0.489400, -0.043810, 0.182250,
-    -0.545310, 0.052650, 0.198200,
-    -0.624980, -0.006860, 0.223080,
-    -0.607490, -0.108590, 0.216590,
-    -0.579800, -0.080130, 0.048600,
-    -0.590790, 0.033320, 0.008110,
-    -0.671240, 0.001010, 0.200700,
-    -0.649340, 0.001890, 0.315570,
-    -0.585430, -0.004430, 0.410960,
-    -0.624980, -0.006860, 0.223080,
-    -0.614030, 0.000120, -0.000090,
-    -0.671240, 0.001010, 0.200700,
-    -0.624980, -0.006860, 0.223080,
-    -0.590790, 0.033320, 0.008110,
-    -0.545310, 0.052650, 0.198200,
-    -0.647210, 0.389610, 0.000000,
-    -0.590790, 0.033320, 0.008110,
-    -0.478810, 0.352680, 0.675580,
-    -0.483570, 0.185970, 0.508700,
-    -0.513590, 0.289090, 0.690640,
-    -0.422470, -0.083520, 0.456840,
-    -0.273910, -0.118180, 0.323690,
-    -0.325160, -0.229480, 0.383800,
-    -0.139350, 0.248770, 0.781540,
-    -0.218320, 0.119180, 0.550370,
-    -0.084830, 0.092980, 0.730790,
-    -0.422470, -0.083520, 0.456840,
-    -0.332500, -0.285900, 0.583760,
-    -0.467540, -0.277280, 0.576690,
-    -0.522910, -0.087920, 0.455800,
-    -0.155510, -0.209040, 0.872040,
-    -0.080090, 0.040600, 0.851780,
-    -0.227640, -0.073920, 0.776070,
-    -0.255630, -0.009010, 0.770000,
-    -0.084830, 0.092980, 0.730790,
-    -0.218320, 0.119180, 0.550370,
-    -0.255630, -0.009010, 0.770000,
-    -0.104650, 0.058610, 0.805920,
-    -0.084830, 0.092980, 0.730790,
-    -0.080090, 0.040600, 0.851780,
-    -0.104650, 0.058610, 0.805920,
-    -0.255630, -0.009010, 0.770000,
-    -0.084830, 0.092980, 0.730790,
-    -0.104650, 0.058610, 0.805920,
-    -0.062370, 0.183910, 0.830680,
-    -0.629060, -0.001120, -0.278960,
-    -0.590790, 0.033320, 0.008110,
-    -0.647210, 0.389610, 0.000000,
-    -0.679660, 0.388500, -0.332720,
-    -0.524240, 0.250530, 0.314880,
-    -0.542050, 0.671160, 0.275640,
-    -0.647210, 0.389610, 0.000000,
-    -0.489400, -0.043810, 0.182250,
-    -0.415500, -0.123990, 0.123720,
-    -0.343340, -0.053960, 0.311700,
-    -0.501830, -0.087230, -0.064250,
-    -0.415500, -0.123990, 0.123720,
-    -0.489400, -0.043810, 0.182250,
-    -0.583460, 0.024460, 0.514410,
-    -0.539220, 0.208810, 0.604030,
-    -0.483570, 0.185970, 0.508700,
-    -0.531090, 0.024920, 0.505060,
-    -0.325410, 0.309890, 0.771630,
-    -0.513590, 0.289090, 0.690640,
-    -0.506450, 0.251750, 0.703060,
-    -0.422470, -0.083520, 0.456840,
-    -0.522910, -0.087920, 0.455800,
-    -0.531090, 0.024920, 0.505060,
-    -0.531000, 0.159460, 0.628180,
-    -0.551330, 0.021730, 0.589190,
-    -0.509600, 0.041210, 0.621820,
-    -0.551330, 0.021730, 0.589190,
-    -0.441340, -0.007760, 0.683470,
-    -0.509600, 0.041210, 0.621820,
-    -0.467540, -0.277280, 0.576690,
-    -0.551330, 0.021730, 0.589190,
-    -0.610270, -0.115140, 0.434580,
-    -0.467540, -0.277280, 0.576690,
-    -0.441340, -0.007760, 0.683470,
-    -0.551330, 0.021730, 0.589190,
-    -0.273910, -0.118180, 0.323690,
-    -0.422470, -0.083520, 0.456840,
-    -0.426180, 0.045370, 0.461920,
-    -0.426180, 0.045370, 0.461920,
-    -0.483570, 0.185970, 0.508700,
-    -0.524240, 0.250530, 0.314880,
-    -0.343340, -0.053960, 0.311700,
-    -0.489400, -0.043810, 0.182250,
-    -0.343340, -0.053960, 0.311700,
-    -0.545310, 0.052650, 0.198200,
-    -0.343340, -0.053960, 0.311700,
-    -0.524240, 0.250530, 0.314880,
-    -0.545310, 0.052650, 0.198200,
-    -0.343340, -0.053960, 0.311700,
-    -0.415500, -0.123990, 0.123720,
-    -0.273910, -0.118180, 0.323690,
-    -0.196950, -0.176730, 0.253760,
-    -0.273910, -0.118180, 0.323690,
-    -0.415500, -0.123990, 0.123720,
-    -0.325160, -0.229480, 0.383800,
-    -0.273910, -0.118180, 0.323690,
-    -0.196950, -0.176730, 0.253760,
-    -0.415500, -0.123990, 0.123720,
-    -0.445530, -0.306890, -0.177360,
-    -0.296630, -0.300450, -0.175050,
-    -0.196950, -0.176730, 0.253760,
-    -0.325160, -0.229480, 0.383800,
-    -0.196950, -0.176730, 0.253760,
-    -0.331390, -0.353320, 0.395430,
-    -0.240090, -0.347070, 0.396100,
-    -0.331390, -0.353320, 0.395430,
-    -0.196950, -0.176730, 0.253760,
-    -0.261780, -0.432710, 0.398820,
-    -0.326840, -0.432710, 0.398820,
-    -0.331390, -0.353320, 0.395430,
-    -0.240090, -0.347070, 0.396100,
-    -0.196080, 0.410900, 0.861420,
-    -0.325410, 0.309890, 0.771630,
-    -0.136020, 0.289880, 0.866910,
-    -0.478810, 0.352680, 0.675580,
-    -0.325410, 0.309890, 0.771630,
-    -0.196080, 0.410900, 0.861420,
-    -0.494300, 0.589190, 0.510980,
-    -0.478810, 0.352680, 0.675580,
-    -0.377070, 0.710650, 0.578340,
-    -0.278240, -0.501180, 0.732020,
-    -0.227270, -0.496280, 0.711580,
-    -0.128000, -0.516250, 0.866500,
-    -0.161350, -0.524330, 0.894180,
-    -0.161350, -0.524330, 0.894180,
-    -0.128000, -0.516250, 0.866500,
-    0.000000, -0.524830, 0.902040,
-    0.000000, -0.525980, 0.958480,
-    -0.326840, -0.432710, 0.398820,
-    -0.261780, -0.432710, 0.398820,
-    -0.255000, -0.461810, 0.501250,
-    -0.312870, -0.469740, 0.520600,
-    -0.312870, -0.469740, 0.520600,
-    -0.255000, -0.461810, 0.501250,
-    -0.227270, -0.496280, 0.711580,
-    -0.278240, -0.501180, 0.732020,
-    -0.255000, -0.461810, 0.501250,
-    -0.255000, -0.371390, 0.501250,
-    -0.227270, -0.405860, 0.711580,
-    -0.227270, -0.496280, 0.711580,
-    -0.128000, -0.516250, 0.866500,
-    -0.128000, -0.425830, 0.866500,
-    0.000000, -0.434400, 0.902040,
-    0.000000, -0.524830, 0.902040,
-    -0.227270, -0.496280, 0.711580,
-    -0.227270, -0.405860, 0.711580,
-    -0.128000, -0.425830, 0.866500,
-    -0.128000, -0.516250, 0.866500,
-    -0.261780, -0.432710, 0.398820,
-    -0.240090, -0.347070, 0.396100,
-    -0.255000, -0.371390, 0.501250,
-    -0.255000, -0.461810, 0.501250,
-    -0.240090, -0.347070, 0.396100,
-    -0.173500, -0.246610, 0.469090,
-    -0.255000, -0.371390, 0.501250,
-    -0.128000, -0.425830, 0.866500,
-    -0.076130, -0.327980, 0.809410,
-    0.000000, -0.334970, 0.838360,
-    0.000000, -0.434400, 0.902040,
-    -0.255000, -0.371390, 0.501250,
-    -0.173500, -0.246610, 0.469090,
-    -0.139430, -0.311720, 0.683230,
-    -0.227270, -0.405860, 0.711580,
-    -0.227270, -0.405860, 0.711580,
-    -0.139430, -0.311720, 0.683230,
-    -0.076130, -0.327980, 0.809410,
-    -0.128000, -0.425830, 0.866500,
-    -0.173500, -0.246610, 0.469090,
-    0.000000, -0.206240, 0.464180,
-    0.000000, -0.236670, 0.678330,
-    -0.139430, -0.311720, 0.683230,
-    -0.139430, -0.311720, 0.683230,
-    0.000000, -0.236670, 0.678330,
-    -0.076130, -0.327980, 0.809410,
-    -0.076130, -0.327980, 0.809410,
-    0.000000, -0.236670, 0.678330,
-    0.000000, -0.334970, 0.838360,
-    -0.240090, -0.347070, 0.396100,
-    -0.196950, -0.176730, 0.253760,
-    -0.173500, -0.246610, 0.469090,
-    -0.196950, -0.176730, 0.253760,
-    0.000000, -0.155730, 0.256230,
-    0.000000, -0.206240, 0.464180,
-    -0.173500, -0.246610, 0.469090,
-    -0.539220, 0.208810, 0.604030,
-    -0.531000, 0.159460, 0.628180,
-    -0.506450, 0.251750, 0.703060,
-    -0.513590, 0.289090, 0.690640,
-    -0.196080, 0.410900, 0.861420,
-    -0.377070, 0.710650, 0.578340,
-    -0.478810, 0.352680, 0.675580,
-    -0.178880, 0.788180, 0.625020,
-    -0.377070, 0.710650, 0.578340,
-    -0.196080, 0.410900, 0.861420,
-};
-uint16_t scene_indices[] = {
-    0, 1, 2,
-    7, 8, 9,
-    54, 55, 56,
-    57, 58, 59,
-    60, 61, 62,
-    75, 76, 77,
-    78, 79, 80,
-    85, 86, 87,
-    96, 97, 98,
-    99, 100, 101,
-    102, 103, 104,
-    105, 106, 107,
-    108, 109, 110,
-    111, 112, 113,
-    114, 115, 116,
-    117, 118, 119,
-    120, 121, 122,
-    127, 128, 129,
-    170, 171, 172,
-    173, 174, 175,
-    176, 177, 178,
-    179, 180, 181,
-    190, 191, 192,
-    197, 198, 199,
-    244, 245, 246,
-    247, 248, 249,
-    250, 251, 252,
-    265, 266, 267,
-    268, 269, 270,
-    275, 276, 277,
-    286, 287, 288,
-    289, 290, 291,
-    292, 293, 294,
-    295, 296, 297,
-    298, 299, 300,
-    301, 302, 303,
-    304, 305, 306,
-    307, 308, 309,
-    310, 311, 312,
-    317, 318, 319,
-    360, 361, 362,
-    363, 364, 365,
-    366, 367, 368,
-    369, 370, 371,
-    3, 4, 5,
-    3, 5, 6,
-    10, 11, 12,
-    10, 12, 13,
-    14, 15, 16,
-    14, 16, 17,
-    18, 19, 20,
-    18, 20, 21,
-    22, 23, 24,
-    22, 24, 25,
-    26, 27, 28,
-    26, 28, 29,
-    30, 31, 32,
-    30, 32, 33,
-    34, 35, 36,
-    34, 36, 37,
-    38, 39, 40,
-    38, 40, 41,
-    42, 43, 44,
-    42, 44, 45,
-    46, 47, 48,
-    46, 48, 49,
-    50, 51, 52,
-    50, 52, 53,
-    63, 64, 65,
-    63, 65, 66,
-    67, 68, 69,
-    67, 69, 70,
-    71, 72, 73,
-    71, 73, 74,
-    81, 82, 83,
-    81, 83, 84,
-    88, 89, 90,
-    88, 90, 91,
-    92, 93, 94,
-    92, 94, 95,
-    123, 124, 125,
-    123, 125, 126,
-    130, 131, 132,
-    130, 132, 133,
-    134, 135, 136,
-    134, 136, 137,
-    138, 139, 140,
-    138, 140, 141,
-    142, 143, 144,
-    142, 144, 145,
-    146, 147, 148,
-    146, 148, 149,
-    150, 151, 152,
-    150, 152, 153,
-    154, 155, 156,
-    154, 156, 157,
-    158, 159, 160,
-    158, 160, 161,
-    162, 163, 164,
-    162, 164, 165,
-    166, 167, 168,
-    166, 168, 169,
-    182, 183, 184,
-    182, 184, 185,
-    186, 187, 188,
-    186, 188, 189,
-    193, 194, 195,
-    193, 195, 196,
-    200, 201, 202,
-    200, 202, 203,
-    204, 205, 206,
-    204, 206, 207,
-    208, 209, 210,
-    208, 210, 211,
-    212, 213, 214,
-    212, 214, 215,
-    216, 217, 218,
-    216, 218, 219,
-    220, 221, 222,
-    220, 222, 223,
-    224, 225, 226,
-    224, 226, 227,
-    228, 229, 230,
-    228, 230, 231,
-    232, 233, 234,
-    232, 234, 235,
-    236, 237, 238,
-    236, 238, 239,
-    240, 241, 242,
-    240, 242, 243,
-    253, 254, 255,
-    253, 255, 256,
-    257, 258, 259,
-    257, 259, 260,
-    261, 262, 263,
-    261, 263, 264,
-    271, 272, 273,
-    271, 273, 274,
-    278, 279, 280,
-    278, 280, 281,
-    282, 283, 284,
-    282, 284, 285,
-    313, 314, 315,
-    313, 315, 316,
-    320, 321, 322,
-    320, 322, 323,
-    324, 325, 326,
-    324, 326, 327,
-    328, 329, 330,
-    328, 330, 331,
-    332, 333, 334,
-    332, 334, 335,
-    336, 337, 338,
-    336, 338, 339,
-    340, 341, 342,
-    340, 342, 343,
-    344, 345, 346,
-    344, 346, 347,
-    348, 349, 350,
-    348, 350, 351,
-    352, 353, 354,
-    352, 354, 355,
-    356, 357, 358,
-    356, 358, 359,
-    372, 373, 374,
-    372, 374, 375,
-    376, 377, 378,
-    376, 378, 379,
-    388, 389, 390,
-    395, 396, 397,
-    418, 419, 420,
-    437, 438, 439,
-    444, 445, 446,
-    447, 448, 449,
-    450, 451, 452,
-    457, 458, 459,
-    460, 461, 462,
-    463, 464, 465,
-    482, 483, 484,
-    497, 498, 499,
-    516, 517, 518,
-    527, 528, 529,
-    530, 531, 532,
-    533, 534, 535,
-    536, 537, 538,
-    539, 540, 541,
-    554, 555, 556,
-    557, 558, 559,
-    560, 561, 562,
-    563, 564, 565,
-    566, 567, 568,
-    569, 570, 571,
-    572, 573, 574,
-    575, 576, 577,
-    582, 583, 584,
-    585, 586, 587,
-    588, 589, 590,
-    591, 592, 593,
-    614, 615, 616,
-    617, 618, 619,
-    620, 621, 622,
-    623, 624, 625,
-    626, 627, 628,
-    629, 630, 631,
-    636, 637, 638,
-    639, 640, 641,
-    642, 643, 644,
-    653, 654, 655,
-    656, 657, 658,
-    659, 660, 661,
-    666, 667, 668,
-    673, 674, 675,
-    676, 677, 678,
-    679, 680, 681,
-    686, 687, 688,
-    705, 706, 707,
-    708, 709, 710,
-    711, 712, 713,
-    714, 715, 716,
-    721, 722, 723,
-    724, 725, 726,
-    727, 728, 729,
-    730, 731, 732,
-    733, 734, 735,
-    740, 741, 742,
-    743, 744, 745,
-    746, 747, 748,
-    753, 754, 755,
-    756, 757, 758,
-    759, 760, 761,
-    762, 763, 764,
-    765, 766, 767,
-    768, 769, 770,
-    771, 772, 773,
-    778, 779, 780,
-    781, 782, 783,
-    784, 785, 786,
-    787, 788, 789,
-    790, 791, 792,
-    797, 798, 799,
-    800, 801, 802,
-    807, 808, 809,
-    810, 811, 812,
-    813, 814, 815,
-    848, 849, 850,
-    867, 868, 869,
-    870, 871, 872,
-    873, 874, 875,
-    884, 885, 886,
-    887, 888, 889,
-    898, 899, 900,
-    905, 906, 907,
-    928, 929, 930,
-    947, 948, 949,
-    954, 955, 956,
-    957, 958, 959,
-    960, 961, 962,
-    967, 968, 969,
-    970, 971, 972,
-    973, 974, 975,
-    992, 993, 994,
-    1007, 1008, 1009,
-    1026, 1027, 1028,
-    1037, 1038, 1039,
-    1040, 1041, 1042,
-    1043, 1044, 1045,
-    1046, 1047, 1048,
-    1049, 1050, 1051,
-    1064, 1065, 1066,
-    1067, 1068, 1069,
-    1070, 1071, 1072,
-    1073, 1074, 1075,
-    1076, 1077, 1078,
-    1079, 1080, 1081,
-    1082, 1083, 1084,
-    1085, 1086, 1087,
-    1092, 1093, 1094,
-    1095, 1096, 1097,
-    1098, 1099, 1100,
-    1101, 1102, 1103,
-    1124, 1125, 1126,
-    1127, 1128, 1129,
-    1130, 1131, 1132,
-    1133, 1134, 1135,
-    1136, 1137, 1138,
-    1139, 1140, 1141,
-    1146, 1147, 1148,
-    1149, 1150, 1151,
-    1152, 1153, 1154,
-    1163, 1164, 1165,
-    1166, 1167, 1168,
-    1169, 1170, 1171,
-    1176, 1177, 1178,
-    1183, 1184, 1185,
-    1186, 1187, 1188,
-    1189, 1190, 1191,
-    1196, 1197, 1198,
-    1215, 1216, 1217,
-    1218, 1219, 1220,
-    1221, 1222, 1223,
-    1224, 1225, 1226,
-    1231, 1232, 1233,
-    1234, 1235, 1236,
-    1237, 1238, 1239,
-    1240, 1241, 1242,
-    1243, 1244, 1245,
-    1250, 1251, 1252,
-    1253, 1254, 1255,
-    1256, 1257, 1258,
-    1263, 1264, 1265,
-    1266, 1267, 1268,
-    1269, 1270, 1271,
-    1272, 1273, 1274,
-    1275, 1276, 1277,
-    1278, 1279, 1280,
-    1281, 1282, 1283,
-    1288, 1289, 1290,
-    1291, 1292, 1293,
-    1294, 1295, 1296,
-    1297, 1298, 1299,
-    1300, 1301, 1302,
-    1307, 1308, 1309,
-    1310, 1311, 1312,
-    1317, 1318, 1319,
-    1320, 1321, 1322,
-    1323, 1324, 1325,
-    1358, 1359, 1360,
-    1377, 1378, 1379,
-    1380, 1381, 1382,
-    1383, 1384, 1385,
-    1394, 1395, 1396,
-    1397, 1398, 1399,
-    380, 381, 382,
-    380, 382, 383,
-    384, 385, 386,
-    384, 386, 387,
-    391, 392, 393,
-    391, 393, 394,
-    398, 399, 400,
-    398, 400, 401,
-    402, 403, 404,
-    402, 404, 405,
-    406, 407, 408,
-    406, 408, 409,
-    410, 411, 412,
-    410, 412, 413,
-    414, 415, 416,
-    414, 416, 417,
-    421, 422, 423,
-    421, 423, 424,
-    425, 426, 427,
-    425, 427, 428,
-    429, 430, 431,
-    429, 431, 432,
-    433, 434, 435,
-    433, 435, 436,
-    440, 441, 442,
-    440, 442, 443,
-    453, 454, 455,
-    453, 455, 456,
-    466, 467, 468,
-    466, 468, 469,
-    470, 471, 472,
-    470, 472, 473,
-    474, 475, 476,
-    474, 476, 477,
-    478, 479, 480,
-    478, 480, 481,
-    485, 486, 487,
-    485, 487, 488,
-    489, 490, 491,
-    489, 491, 492,
-    493, 494, 495,
-    493, 495, 496,
-    500, 501, 502,
-    500, 502, 503,
-    504, 505, 506,
-    504, 506, 507,
-    508, 509, 510,
-    508, 510, 511,
-    512, 513, 514,
-    512, 514, 515,
-    519, 520, 521,
-    519, 521, 522,
-    523, 524, 525,
-    523, 525, 526,
-    542, 543, 544,
-    542, 544, 545,
-    546, 547, 548,
-    546, 548, 549,
-    550, 551, 552,
-    550, 552, 553,
-    578, 579, 580,
-    578, 580, 581,
-    594, 595, 596,
-    594, 596, 597,
-    598, 599, 600,
-    598, 600, 601,
-    602, 603, 604,
-    602, 604, 605,
-    606, 607, 608,
-    606, 608, 609,
-    610, 611, 612,
-    610, 612, 613,
-    632, 633, 634,
-    632, 634, 635,
-    645, 646, 647,
-    645, 647, 648,
-    649, 650, 651,
-    649, 651, 652,
-    662, 663, 664,
-    662, 664, 665,
-    669, 670, 671,
-    669, 671, 672,
-    682, 683, 684,
-    682, 684, 685,
-    689, 690, 691,
-    689, 691, 692,
-    693, 694, 695,
-    693, 695, 696,
-    697, 698, 699,
-    697, 699, 700,
-    701, 702, 703,
-    701, 703, 704,
-    717, 718, 719,
-    717, 719, 720,
-    736, 737, 738,
-    736, 738, 739,
-    749, 750, 751,
-    749, 751, 752,
-    774, 775, 776,
-    774, 776, 777,
-    793, 794, 795,
-    793, 795, 796,
-    803, 804, 805,
-    803, 805, 806,
-    816, 817, 818,
-    816, 818, 819,
-    820, 821, 822,
-    820, 822, 823,
-    824, 825, 826,
-    824, 826, 827,
-    828, 829, 830,
-    828, 830, 831,
-    832, 833, 834,
-    832, 834, 835,
-    836, 837, 838,
-    836, 838, 839,
-    840, 841, 842,
-    840, 842, 843,
-    844, 845, 846,
-    844, 846, 847,
-    851, 852, 853,
-    851, 853, 854,
-    855, 856, 857,
-    855, 857, 858,
-    859, 860, 861,
-    859, 861, 862,
-    863, 864, 865,
-    863, 865, 866,
-    876, 877, 878,
-    876, 878, 879,
-    880, 881, 882,
-    880, 882, 883,
-    890, 891, 892,
-    890, 892, 893,
-    894, 895, 896,
-    894, 896, 897,
-    901, 902, 903,
-    901, 903, 904,
-    908, 909, 910,
-    908, 910, 911,
-    912, 913, 914,
-    912, 914, 915,
-    916, 917, 918,
-    916, 918, 919,
-    920, 921, 922,
-    920, 922, 923,
-    924, 925, 926,
-    924, 926, 927,
-    931, 932, 933,
-    931, 933, 934,
-    935, 936, 937,
-    935, 937, 938,
-    939, 940, 941,
-    939, 941, 942,
-    943, 944, 945,
-    943, 945, 946,
-    950, 951, 952,
-    950, 952, 953,
-    963, 964, 965,
-    963, 965, 966,
-    976, 977, 978,
-    976, 978, 979,
-    980, 981, 982,
-    980, 982, 983,
-    984, 985, 986,
-    984, 986, 987,
-    988, 989, 990,
-    988, 990, 991,
-    995, 996, 997,
-    995, 997, 998,
-    999, 1000, 1001,
-    999, 1001, 1002,
-    1003, 1004, 1005,
-    1003, 1005, 1006,
-    1010, 1011, 1012,
-    1010, 1012, 1013,
-    1014, 1015, 1016,
-    1014, 1016, 1017,
-    1018, 1019, 1020,
-    1018, 1020, 1021,
-    1022, 1023, 1024,
-    1022, 1024, 1025,
-    1029, 1030, 1031,
-    1029, 1031, 1032,
-    1033, 1034, 1035,
-    1033, 1035, 1036,
-    1052, 1053, 1054,
-    1052, 1054, 1055,
-    1056, 1057, 1058,
-    1056, 1058, 1059,
-    1060, 1061, 1062,
-    1060, 1062, 1063,
-    1088, 1089, 1090,
-    1088, 1090, 1091,
-    1104, 1105, 1106,
-    1104, 1106, 1107,
-    1108, 1109, 1110,
-    1108, 1110, 1111,
-    1112, 1113, 1114,
-    1112, 1114, 1115,
-    1116, 1117, 1118,
-    1116, 1118, 1119,
-    1120, 1121, 1122,
-    1120, 1122, 1123,
-    1142, 1143, 1144,
-    1142, 1144, 1145,
-    1155, 1156, 1157,
-    1155, 1157, 1158,
-    1159, 1160, 1161,
-    1159, 1161, 1162,
-    1172, 1173, 1174,
-    1172, 1174, 1175,
-    1179, 1180, 1181,
-    1179, 1181, 1182,
-    1192, 1193, 1194,
-    1192, 1194, 1195,
-    1199, 1200, 1201,
-    1199, 1201, 1202,
-    1203, 1204, 1205,
-    1203, 1205, 1206,
-    1207, 1208, 1209,
-    1207, 1209, 1210,
-    1211, 1212, 1213,
-    1211, 1213, 1214,
-    1227, 1228, 1229,
-    1227, 1229, 1230,
-    1246, 1247, 1248,
-    1246, 1248, 1249,
-    1259, 1260, 1261,
-    1259, 1261, 1262,
-    1284, 1285, 1286,
-    1284, 1286, 1287,
-    1303, 1304, 1305,
-    1303, 1305, 1306,
-    1313, 1314, 1315,
-    1313, 1315, 1316,
-    1326, 1327, 1328,
-    1326, 1328, 1329,
-    1330, 1331, 1332,
-    1330, 1332, 1333,
-    1334, 1335, 1336,
-    1334, 1336, 1337,
-    1338, 1339, 1340,
-    1338, 1340, 1341,
-    1342, 1343, 1344,
-    1342, 1344, 1345,
-    1346, 1347, 1348,
-    1346, 1348, 1349,
-    1350, 1351, 1352,
-    1350, 1352, 1353,
-    1354, 1355, 1356,
-    1354, 1356, 1357,
-    1361, 1362, 1363,
-    1361, 1363, 1364,
-    1365, 1366, 1367,
-    1365, 1367, 1368,
-    1369, 1370, 1371,
-    1369, 1371, 1372,
-    1373, 1374, 1375,
-    1373, 1375, 1376,
-    1386, 1387, 1388,
-    1386, 1388, 1389,
-    1390, 1391, 1392,
-    1390, 1392, 1393
+// Model units are 1/256 of the original float coordinates.  Coincident
+// vertices are welded so faces share indices and meshInit finds every
+// shared edge.
+static const meshVertexT scene_vertices[] = {
+    { 135, -64, 60 },
+    { 113, -142, 97 },
+    { 137, -171, 18 },
+    { 33, -152, 221 },
+    { 58, -147, 183 },
+    { 74, -232, 153 },
+    { 38, -244, 196 },
+    { 152, -20, 21 },
+    { 148, -21, 3 },
+    { 35, -183, 220 },
+    { 41, -241, 222 },
+    { 65, -236, 200 },
+    { 64, -177, 196 },
+    { 128, -21, 4 },
+    { 120, -179, 18 },
+    { 0, -185, 232 },
+    { 0, -228, 233 },
+    { 0, -245, 208 },
+    { 0, -242, 229 },
+    { 87, -229, 164 },
+    { 74, -167, 156 },
+    { 80, -135, 137 },
+    { 66, -147, 191 },
+    { 0, -155, 240 },
+    { 38, -153, 229 },
+    { 80, -132, 92 },
+    { 96, -137, 103 },
+    { 124, -26, 102 },
+    { 116, -27, 94 },
+    { 116, -201, 90 },
+    { 102, -205, 83 },
+    { 0, -153, 231 },
+    { 65, -140, 131 },
+    { 38, -135, 230 },
+    { 71, -129, 186 },
+    { 0, -136, 242 },
+    { 80, -121, 134 },
+    { 82, -152, 129 },
+    { 75, -122, 98 },
+    { 85, -124, 102 },
+    { 122, -64, 60 },
+    { 83, -112, 103 },
+    { 70, -112, 105 },
+    { 33, -134, 221 },
+    { 0, -135, 231 },
+    { 56, -129, 183 },
+    { 65, -123, 131 },
+    { -135, -64, 60 },
+    { -137, -171, 18 },
+    { -113, -142, 97 },
+    { -33, -152, 221 },
+    { -38, -244, 196 },
+    { -74, -232, 153 },
+    { -58, -147, 183 },
+    { -152, -20, 21 },
+    { -148, -21, 3 },
+    { -35, -183, 220 },
+    { -64, -177, 196 },
+    { -65, -236, 200 },
+    { -41, -241, 222 },
+    { -128, -21, 4 },
+    { -120, -179, 18 },
+    { -74, -167, 156 },
+    { -87, -229, 164 },
+    { -80, -135, 137 },
+    { -66, -147, 191 },
+    { -38, -153, 229 },
+    { -80, -132, 92 },
+    { -116, -27, 94 },
+    { -124, -26, 102 },
+    { -96, -137, 103 },
+    { -102, -205, 83 },
+    { -116, -201, 90 },
+    { -65, -140, 131 },
+    { -38, -135, 230 },
+    { -71, -129, 186 },
+    { -80, -121, 134 },
+    { -82, -152, 129 },
+    { -85, -124, 102 },
+    { -75, -122, 98 },
+    { -122, -64, 60 },
+    { -83, -112, 103 },
+    { -70, -112, 105 },
+    { -33, -134, 221 },
+    { -56, -129, 183 },
+    { -65, -123, 131 },
+    { 78, 93, -227 },
+    { 79, 182, -183 },
+    { 154, 146, -152 },
+    { 154, 75, -185 },
+    { 76, 5, -233 },
+    { 143, 0, -175 },
+    { 117, -59, -151 },
+    { 80, -53, -173 },
+    { 151, -80, -58 },
+    { 174, 99, -85 },
+    { 162, 178, -81 },
+    { 136, 6, 129 },
+    { 109, 12, 118 },
+    { 124, 48, 130 },
+    { 114, -79, -45 },
+    { 81, 229, -97 },
+    { 74, 223, 86 },
+    { 97, 182, 148 },
+    { 127, 151, 131 },
+    { 139, 172, 71 },
+    { 77, 243, 0 },
+    { 153, 184, 0 },
+    { 50, -45, 65 },
+    { 0, -40, 66 },
+    { 0, -72, -45 },
+    { 76, -77, -45 },
+    { 166, 100, 0 },
+    { 161, 0, -71 },
+    { 46, 202, 160 },
+    { 0, -85, -139 },
+    { 42, -58, -197 },
+    { 72, -88, -122 },
+    { 131, 74, 177 },
+    { 123, 90, 173 },
+    { 83, 79, 198 },
+    { 83, -59, 98 },
+    { 108, -21, 117 },
+    { 85, -73, 149 },
+    { 172, 0, 51 },
+    { 166, 0, 81 },
+    { 156, -29, 111 },
+    { 165, -23, 47 },
+    { 149, 6, 132 },
+    { 141, 6, 151 },
+    { 159, -16, 7 },
+    { 148, -21, 12 },
+    { 128, -22, -16 },
+    { 120, -71, 148 },
+    { 134, -23, 117 },
+    { 40, -112, 227 },
+    { 0, -111, 248 },
+    { 0, -135, 245 },
+    { 41, -134, 229 },
+    { 156, -28, 55 },
+    { 0, 27, 240 },
+    { 21, 10, 218 },
+    { 16, 47, 213 },
+    { 0, 47, 220 },
+    { 69, -106, 184 },
+    { 71, -128, 187 },
+    { 0, -59, 250 },
+    { 0, -83, 244 },
+    { 40, -54, 223 },
+    { 0, 105, -246 },
+    { 0, 197, -203 },
+    { 0, -6, -250 },
+    { 0, -55, -204 },
+    { 0, 80, 226 },
+    { 50, 105, 221 },
+    { 0, 209, 170 },
+    { 0, 249, -112 },
+    { 0, 243, 96 },
+    { 0, 264, 0 },
+    { 35, 74, 222 },
+    { 150, -1, 105 },
+    { 36, 64, 200 },
+    { 136, 41, 161 },
+    { 138, 53, 155 },
+    { 81, -100, 137 },
+    { 77, -62, 175 },
+    { 157, 0, 0 },
+    { 151, 9, 2 },
+    { 134, 64, 81 },
+    { 140, 13, 51 },
+    { 155, -16, -50 },
+    { 56, 31, 141 },
+    { 130, 64, 180 },
+    { 27, 15, 206 },
+    { 125, -11, 47 },
+    { 80, -120, 133 },
+    { 84, -111, 102 },
+    { 85, -90, 101 },
+    { 130, 11, 159 },
+    { 0, -57, 213 },
+    { 22, 24, 187 },
+    { 65, -2, 197 },
+    { 113, -2, 175 },
+    { 58, -19, 199 },
+    { 106, -32, 32 },
+    { 70, -30, 83 },
+    { 88, -14, 80 },
+    { 160, -2, 57 },
+    { 61, -89, 101 },
+    { 67, -111, 102 },
+    { 33, -132, 222 },
+    { 58, -127, 182 },
+    { 0, -134, 231 },
+    { 65, -118, 128 },
+    { 58, -104, 182 },
+    { 65, -95, 128 },
+    { 0, -111, 231 },
+    { 33, -109, 222 },
+    { 44, -63, 120 },
+    { 0, -86, 215 },
+    { 19, -84, 207 },
+    { 36, -80, 175 },
+    { 0, -61, 174 },
+    { 0, -53, 119 },
+    { -78, 93, -227 },
+    { -154, 75, -185 },
+    { -154, 146, -152 },
+    { -79, 182, -183 },
+    { -76, 5, -233 },
+    { -80, -53, -173 },
+    { -117, -59, -151 },
+    { -143, 0, -175 },
+    { -151, -80, -58 },
+    { -174, 99, -85 },
+    { -162, 178, -81 },
+    { -136, 6, 129 },
+    { -124, 48, 130 },
+    { -109, 12, 118 },
+    { -114, -79, -45 },
+    { -81, 229, -97 },
+    { -74, 223, 86 },
+    { -139, 172, 71 },
+    { -127, 151, 131 },
+    { -97, 182, 148 },
+    { -77, 243, 0 },
+    { -153, 184, 0 },
+    { -50, -45, 65 },
+    { -76, -77, -45 },
+    { -166, 100, 0 },
+    { -161, 0, -71 },
+    { -46, 202, 160 },
+    { -72, -88, -122 },
+    { -42, -58, -197 },
+    { -131, 74, 177 },
+    { -83, 79, 198 },
+    { -123, 90, 173 },
+    { -83, -59, 98 },
+    { -85, -73, 149 },
+    { -108, -21, 117 },
+    { -172, 0, 51 },
+    { -165, -23, 47 },
+    { -156, -29, 111 },
+    { -166, 0, 81 },
+    { -141, 6, 151 },
+    { -149, 6, 132 },
+    { -159, -16, 7 },
+    { -128, -22, -16 },
+    { -148, -21, 12 },
+    { -134, -23, 117 },
+    { -120, -71, 148 },
+    { -40, -112, 227 },
+    { -41, -134, 229 },
+    { -156, -28, 55 },
+    { -16, 47, 213 },
+    { -21, 10, 218 },
+    { -69, -106, 184 },
+    { -71, -128, 187 },
+    { -40, -54, 223 },
+    { -50, 105, 221 },
+    { -35, 74, 222 },
+    { -150, -1, 105 },
+    { -36, 64, 200 },
+    { -136, 41, 161 },
+    { -138, 53, 155 },
+    { -77, -62, 175 },
+    { -81, -100, 137 },
+    { -157, 0, 0 },
+    { -151, 9, 2 },
+    { -134, 64, 81 },
+    { -140, 13, 51 },
+    { -155, -16, -50 },
+    { -56, 31, 141 },
+    { -130, 64, 180 },
+    { -27, 15, 206 },
+    { -125, -11, 47 },
+    { -85, -90, 101 },
+    { -84, -111, 102 },
+    { -80, -120, 133 },
+    { -130, 11, 159 },
+    { -22, 24, 187 },
+    { -113, -2, 175 },
+    { -65, -2, 197 },
+    { -58, -19, 199 },
+    { -106, -32, 32 },
+    { -88, -14, 80 },
+    { -70, -30, 83 },
+    { -160, -2, 57 },
+    { -61, -89, 101 },
+    { -67, -111, 102 },
+    { -58, -127, 182 },
+    { -33, -132, 222 },
+    { -65, -118, 128 },
+    { -65, -95, 128 },
+    { -58, -104, 182 },
+    { -33, -109, 222 },
+    { -44, -63, 120 },
+    { -19, -84, 207 },
+    { -36, -80, 175 },
 };
-const float sinTable[60]={
-    0.0, 0.104528, 0.207912, 0.309017, 0.406737, 0.5, 0.587785, 0.669131,
-    0.743145, 0.809017, 0.866025, 0.913545, 0.951057, 0.978148, 0.994522,
-    1.0, 0.994522, 0.978148, 0.951057, 0.913545, 0.866025, 0.809017,
-    0.743145, 0.669131, 0.587785, 0.5, 0.406737, 0.309017, 0.207912,
-    0.104528, 1.23e-16, -0.104530, -0.207910, -0.309020, -0.406740,
-    -0.5, -0.587790, -0.669130, -0.743140, -0.809020, -0.866030,
-    -0.913550, -0.951060, -0.978150, -0.994520, -1.0, -0.994520,
-    -0.978150, -0.951060, -0.913550, -0.866030, -0.809020, -0.743140,
-    -0.669130, -0.587790, -0.5, -0.406740, -0.309020, -0.207910,
-    -0.104530
+// Packed faces: vertex count, then indices.
+static const uint16_t scene_faces[] = {
+    3, 0, 1, 2,
+    3, 7, 2, 8,
+    3, 4, 32, 5,
+    3, 25, 14, 30,
+    3, 25, 13, 14,
+    3, 19, 26, 37,
+    3, 26, 19, 1,
+    3, 7, 0, 2,
+    3, 8, 13, 7,
+    3, 37, 21, 20,
+    3, 40, 25, 28,
+    3, 25, 40, 13,
+    3, 20, 19, 37,
+    3, 27, 26, 1,
+    3, 19, 29, 1,
+    3, 27, 1, 0,
+    3, 1, 29, 2,
+    3, 39, 21, 37,
+    3, 32, 38, 25,
+    3, 10, 6, 11,
+    3, 10, 16, 18,
+    3, 26, 39, 37,
+    3, 47, 48, 49,
+    3, 54, 55, 48,
+    3, 53, 52, 73,
+    3, 67, 71, 61,
+    3, 67, 61, 60,
+    3, 63, 77, 70,
+    3, 70, 49, 63,
+    3, 54, 48, 47,
+    3, 55, 54, 60,
+    3, 77, 62, 64,
+    3, 80, 68, 67,
+    3, 67, 60, 80,
+    3, 62, 77, 63,
+    3, 69, 49, 70,
+    3, 63, 49, 72,
+    3, 69, 47, 49,
+    3, 49, 48, 72,
+    3, 78, 77, 64,
+    3, 73, 67, 79,
+    3, 59, 58, 51,
+    3, 59, 18, 16,
+    3, 70, 77, 78,
+    3, 3, 4, 5,
+    3, 3, 5, 6,
+    3, 9, 10, 11,
+    3, 9, 11, 12,
+    3, 13, 8, 2,
+    3, 13, 2, 14,
+    3, 15, 16, 10,
+    3, 15, 10, 9,
+    3, 17, 6, 10,
+    3, 17, 10, 18,
+    3, 12, 11, 19,
+    3, 12, 19, 20,
+    3, 21, 22, 12,
+    3, 21, 12, 20,
+    3, 23, 15, 9,
+    3, 23, 9, 24,
+    3, 24, 9, 12,
+    3, 24, 12, 22,
+    3, 25, 26, 27,
+    3, 25, 27, 28,
+    3, 2, 29, 30,
+    3, 2, 30, 14,
+    3, 17, 31, 3,
+    3, 17, 3, 6,
+    3, 33, 24, 22,
+    3, 33, 22, 34,
+    3, 35, 23, 24,
+    3, 35, 24, 33,
+    3, 36, 34, 22,
+    3, 36, 22, 21,
+    3, 26, 25, 38,
+    3, 26, 38, 39,
+    3, 40, 28, 27,
+    3, 40, 27, 0,
+    3, 13, 40, 0,
+    3, 13, 0, 7,
+    3, 5, 19, 11,
+    3, 5, 11, 6,
+    3, 36, 21, 39,
+    3, 36, 39, 41,
+    3, 38, 42, 41,
+    3, 38, 41, 39,
+    3, 35, 33, 43,
+    3, 35, 43, 44,
+    3, 33, 34, 45,
+    3, 33, 45, 43,
+    3, 34, 36, 46,
+    3, 34, 46, 45,
+    3, 36, 41, 42,
+    3, 36, 42, 46,
+    3, 43, 45, 4,
+    3, 43, 4, 3,
+    3, 44, 43, 3,
+    3, 44, 3, 31,
+    3, 45, 46, 32,
+    3, 45, 32, 4,
+    3, 46, 42, 38,
+    3, 46, 38, 32,
+    3, 29, 19, 5,
+    3, 29, 5, 30,
+    3, 25, 30, 5,
+    3, 25, 5, 32,
+    3, 50, 51, 52,
+    3, 50, 52, 53,
+    3, 56, 57, 58,
+    3, 56, 58, 59,
+    3, 60, 61, 48,
+    3, 60, 48, 55,
+    3, 15, 56, 59,
+    3, 15, 59, 16,
+    3, 17, 18, 59,
+    3, 17, 59, 51,
+    3, 57, 62, 63,
+    3, 57, 63, 58,
+    3, 64, 62, 57,
+    3, 64, 57, 65,
+    3, 23, 66, 56,
+    3, 23, 56, 15,
+    3, 66, 65, 57,
+    3, 66, 57, 56,
+    3, 67, 68, 69,
+    3, 67, 69, 70,
+    3, 71, 72, 48,
+    3, 71, 48, 61,
+    3, 17, 51, 50,
+    3, 17, 50, 31,
+    3, 74, 75, 65,
+    3, 74, 65, 66,
+    3, 35, 74, 66,
+    3, 35, 66, 23,
+    3, 76, 64, 65,
+    3, 76, 65, 75,
+    3, 70, 78, 79,
+    3, 70, 79, 67,
+    3, 80, 47, 69,
+    3, 80, 69, 68,
+    3, 60, 54, 47,
+    3, 60, 47, 80,
+    3, 52, 51, 58,
+    3, 52, 58, 63,
+    3, 76, 81, 78,
+    3, 76, 78, 64,
+    3, 79, 78, 81,
+    3, 79, 81, 82,
+    3, 35, 44, 83,
+    3, 35, 83, 74,
+    3, 74, 83, 84,
+    3, 74, 84, 75,
+    3, 75, 84, 85,
+    3, 75, 85, 76,
+    3, 76, 85, 82,
+    3, 76, 82, 81,
+    3, 83, 50, 53,
+    3, 83, 53, 84,
+    3, 44, 31, 50,
+    3, 44, 50, 83,
+    3, 84, 53, 73,
+    3, 84, 73, 85,
+    3, 85, 73, 79,
+    3, 85, 79, 82,
+    3, 52, 63, 72,
+    3, 52, 72, 71,
+    3, 67, 73, 52,
+    3, 67, 52, 71,
+    3, 91, 94, 92,
+    3, 97, 98, 99,
+    3, 112, 107, 105,
+    3, 102, 114, 103,
+    3, 118, 119, 120,
+    3, 90, 93, 116,
+    3, 121, 122, 123,
+    3, 126, 128, 129,
+    3, 130, 131, 132,
+    3, 126, 133, 134,
+    3, 146, 147, 148,
+    3, 115, 152, 116,
+    3, 153, 159, 154,
+    3, 117, 100, 111,
+    3, 117, 93, 100,
+    3, 128, 125, 160,
+    3, 159, 142, 161,
+    3, 141, 140, 148,
+    3, 166, 113, 167,
+    3, 168, 169, 112,
+    3, 170, 130, 132,
+    3, 113, 170, 94,
+    3, 94, 170, 132,
+    3, 94, 132, 100,
+    3, 91, 113, 94,
+    3, 171, 162, 172,
+    3, 171, 172, 120,
+    3, 142, 141, 173,
+    3, 174, 132, 131,
+    3, 118, 163, 99,
+    3, 162, 171, 178,
+    3, 148, 140, 179,
+    3, 146, 148, 179,
+    3, 120, 159, 161,
+    3, 142, 180, 161,
+    3, 120, 161, 171,
+    3, 181, 183, 182,
+    3, 165, 183, 148,
+    3, 183, 181, 141,
+    3, 97, 128, 160,
+    3, 105, 104, 168,
+    3, 126, 125, 128,
+    3, 165, 123, 133,
+    3, 132, 184, 100,
+    3, 98, 185, 186,
+    3, 98, 97, 122,
+    3, 97, 160, 134,
+    3, 169, 167, 112,
+    3, 119, 118, 99,
+    3, 122, 121, 185,
+    3, 161, 180, 171,
+    3, 148, 183, 141,
+    3, 181, 171, 180,
+    3, 181, 180, 173,
+    3, 141, 181, 173,
+    3, 180, 142, 173,
+    3, 168, 112, 105,
+    3, 174, 186, 184,
+    3, 132, 174, 184,
+    3, 120, 172, 118,
+    3, 122, 97, 134,
+    3, 162, 178, 129,
+    3, 129, 178, 182,
+    3, 133, 126, 129,
+    3, 133, 129, 182,
+    3, 185, 98, 122,
+    3, 174, 169, 186,
+    3, 186, 169, 168,
+    3, 186, 185, 184,
+    3, 108, 184, 185,
+    3, 121, 108, 185,
+    3, 121, 177, 108,
+    3, 188, 108, 177,
+    3, 154, 159, 120,
+    3, 119, 154, 120,
+    3, 104, 103, 119,
+    3, 188, 195, 198,
+    3, 201, 200, 202,
+    3, 200, 199, 202,
+    3, 188, 198, 108,
+    3, 154, 119, 103,
+    3, 114, 154, 103,
+    3, 211, 210, 212,
+    3, 215, 216, 217,
+    3, 228, 221, 225,
+    3, 220, 223, 230,
+    3, 233, 234, 235,
+    3, 208, 232, 209,
+    3, 236, 237, 238,
+    3, 241, 243, 244,
+    3, 245, 246, 247,
+    3, 241, 248, 249,
+    3, 146, 257, 147,
+    3, 115, 232, 152,
+    3, 153, 258, 259,
+    3, 231, 227, 218,
+    3, 231, 218, 209,
+    3, 244, 260, 242,
+    3, 259, 261, 253,
+    3, 254, 257, 140,
+    3, 266, 267, 229,
+    3, 268, 228, 269,
+    3, 270, 246, 245,
+    3, 229, 212, 270,
+    3, 212, 246, 270,
+    3, 212, 218, 246,
+    3, 211, 212, 229,
+    3, 271, 272, 262,
+    3, 271, 234, 272,
+    3, 253, 273, 254,
+    3, 274, 247, 246,
+    3, 233, 216, 263,
+    3, 262, 278, 271,
+    3, 257, 179, 140,
+    3, 146, 179, 257,
+    3, 234, 261, 259,
+    3, 253, 261, 279,
+    3, 234, 271, 261,
+    3, 281, 280, 282,
+    3, 264, 257, 282,
+    3, 282, 254, 281,
+    3, 215, 260, 244,
+    3, 221, 268, 222,
+    3, 241, 244, 242,
+    3, 264, 249, 237,
+    3, 246, 218, 283,
+    3, 217, 284, 285,
+    3, 217, 238, 215,
+    3, 215, 248, 260,
+    3, 269, 228, 267,
+    3, 235, 216, 233,
+    3, 238, 285, 236,
+    3, 261, 271, 279,
+    3, 257, 254, 282,
+    3, 281, 279, 271,
+    3, 281, 273, 279,
+    3, 254, 273, 281,
+    3, 279, 273, 253,
+    3, 268, 221, 228,
+    3, 274, 283, 284,
+    3, 246, 283, 274,
+    3, 234, 233, 272,
+    3, 238, 248, 215,
+    3, 262, 243, 278,
+    3, 243, 280, 278,
+    3, 249, 243, 241,
+    3, 249, 280, 243,
+    3, 285, 238, 217,
+    3, 274, 284, 269,
+    3, 284, 268, 269,
+    3, 284, 283, 285,
+    3, 226, 285, 283,
+    3, 236, 285, 226,
+    3, 236, 226, 275,
+    3, 287, 275, 226,
+    3, 258, 234, 259,
+    3, 235, 234, 258,
+    3, 222, 235, 223,
+    3, 287, 295, 292,
+    3, 297, 202, 296,
+    3, 296, 202, 199,
+    3, 287, 226, 295,
+    3, 258, 223, 235,
+    3, 230, 223, 258,
+    3, 86, 87, 88,
+    3, 86, 88, 89,
+    3, 90, 91, 92,
+    3, 90, 92, 93,
+    3, 95, 89, 88,
+    3, 95, 88, 96,
+    3, 100, 93, 92,
+    3, 100, 92, 94,
+    3, 101, 96, 88,
+    3, 101, 88, 87,
+    3, 102, 103, 104,
+    3, 102, 104, 105,
+    3, 106, 102, 105,
+    3, 106, 105, 107,
+    3, 108, 109, 110,
+    3, 108, 110, 111,
+    3, 106, 107, 96,
+    3, 106, 96, 101,
+    3, 112, 95, 96,
+    3, 112, 96, 107,
+    3, 95, 113, 91,
+    3, 95, 91, 89,
+    3, 90, 86, 89,
+    3, 90, 89, 91,
+    3, 115, 116, 93,
+    3, 115, 93, 117,
+    3, 124, 125, 126,
+    3, 124, 126, 127,
+    3, 135, 136, 137,
+    3, 135, 137, 138,
+    3, 130, 127, 139,
+    3, 130, 139, 131,
+    3, 140, 141, 142,
+    3, 140, 142, 143,
+    3, 144, 135, 138,
+    3, 144, 138, 145,
+    3, 149, 150, 87,
+    3, 149, 87, 86,
+    3, 151, 90, 116,
+    3, 151, 116, 152,
+    3, 153, 154, 114,
+    3, 153, 114, 155,
+    3, 156, 101, 87,
+    3, 156, 87, 150,
+    3, 157, 155, 114,
+    3, 157, 114, 102,
+    3, 158, 157, 102,
+    3, 158, 102, 106,
+    3, 158, 106, 101,
+    3, 158, 101, 156,
+    3, 151, 149, 86,
+    3, 151, 86, 90,
+    3, 117, 111, 110,
+    3, 117, 110, 115,
+    3, 162, 129, 128,
+    3, 162, 128, 163,
+    3, 144, 164, 123,
+    3, 144, 123, 165,
+    3, 166, 124, 127,
+    3, 166, 127, 130,
+    3, 143, 142, 159,
+    3, 143, 159, 153,
+    3, 164, 175, 176,
+    3, 164, 176, 177,
+    3, 123, 164, 177,
+    3, 123, 177, 121,
+    3, 145, 175, 164,
+    3, 145, 164, 144,
+    3, 165, 148, 135,
+    3, 165, 135, 144,
+    3, 148, 147, 136,
+    3, 148, 136, 135,
+    3, 178, 171, 181,
+    3, 178, 181, 182,
+    3, 182, 183, 165,
+    3, 182, 165, 133,
+    3, 166, 130, 170,
+    3, 166, 170, 113,
+    3, 104, 119, 99,
+    3, 104, 99, 168,
+    3, 127, 126, 134,
+    3, 127, 134, 139,
+    3, 160, 187, 139,
+    3, 160, 139, 134,
+    3, 167, 169, 174,
+    3, 167, 174, 131,
+    3, 187, 167, 131,
+    3, 187, 131, 139,
+    3, 124, 187, 160,
+    3, 124, 160, 125,
+    3, 166, 167, 187,
+    3, 166, 187, 124,
+    3, 122, 134, 133,
+    3, 122, 133, 123,
+    3, 113, 95, 112,
+    3, 113, 112, 167,
+    3, 128, 97, 99,
+    3, 128, 99, 163,
+    3, 98, 186, 168,
+    3, 98, 168, 99,
+    3, 184, 108, 111,
+    3, 184, 111, 100,
+    3, 189, 188, 177,
+    3, 189, 177, 176,
+    3, 145, 138, 190,
+    3, 145, 190, 191,
+    3, 138, 137, 192,
+    3, 138, 192, 190,
+    3, 176, 175, 193,
+    3, 176, 193, 189,
+    3, 175, 145, 191,
+    3, 175, 191, 193,
+    3, 193, 191, 194,
+    3, 193, 194, 195,
+    3, 190, 192, 196,
+    3, 190, 196, 197,
+    3, 191, 190, 197,
+    3, 191, 197, 194,
+    3, 189, 193, 195,
+    3, 189, 195, 188,
+    3, 197, 196, 199,
+    3, 197, 199, 200,
+    3, 195, 194, 201,
+    3, 195, 201, 198,
+    3, 194, 197, 200,
+    3, 194, 200, 201,
+    3, 198, 201, 202,
+    3, 198, 202, 203,
+    3, 108, 198, 203,
+    3, 108, 203, 109,
+    3, 163, 118, 172,
+    3, 163, 172, 162,
+    3, 204, 205, 206,
+    3, 204, 206, 207,
+    3, 208, 209, 210,
+    3, 208, 210, 211,
+    3, 213, 214, 206,
+    3, 213, 206, 205,
+    3, 218, 212, 210,
+    3, 218, 210, 209,
+    3, 219, 207, 206,
+    3, 219, 206, 214,
+    3, 220, 221, 222,
+    3, 220, 222, 223,
+    3, 224, 225, 221,
+    3, 224, 221, 220,
+    3, 226, 227, 110,
+    3, 226, 110, 109,
+    3, 224, 219, 214,
+    3, 224, 214, 225,
+    3, 228, 225, 214,
+    3, 228, 214, 213,
+    3, 213, 205, 211,
+    3, 213, 211, 229,
+    3, 208, 211, 205,
+    3, 208, 205, 204,
+    3, 115, 231, 209,
+    3, 115, 209, 232,
+    3, 239, 240, 241,
+    3, 239, 241, 242,
+    3, 250, 251, 137,
+    3, 250, 137, 136,
+    3, 245, 247, 252,
+    3, 245, 252, 240,
+    3, 140, 143, 253,
+    3, 140, 253, 254,
+    3, 255, 256, 251,
+    3, 255, 251, 250,
+    3, 149, 204, 207,
+    3, 149, 207, 150,
+    3, 151, 152, 232,
+    3, 151, 232, 208,
+    3, 153, 155, 230,
+    3, 153, 230, 258,
+    3, 156, 150, 207,
+    3, 156, 207, 219,
+    3, 157, 220, 230,
+    3, 157, 230, 155,
+    3, 158, 224, 220,
+    3, 158, 220, 157,
+    3, 158, 156, 219,
+    3, 158, 219, 224,
+    3, 151, 208, 204,
+    3, 151, 204, 149,
+    3, 231, 115, 110,
+    3, 231, 110, 227,
+    3, 262, 263, 244,
+    3, 262, 244, 243,
+    3, 255, 264, 237,
+    3, 255, 237, 265,
+    3, 266, 245, 240,
+    3, 266, 240, 239,
+    3, 143, 153, 259,
+    3, 143, 259, 253,
+    3, 265, 275, 276,
+    3, 265, 276, 277,
+    3, 237, 236, 275,
+    3, 237, 275, 265,
+    3, 256, 255, 265,
+    3, 256, 265, 277,
+    3, 264, 255, 250,
+    3, 264, 250, 257,
+    3, 257, 250, 136,
+    3, 257, 136, 147,
+    3, 278, 280, 281,
+    3, 278, 281, 271,
+    3, 280, 249, 264,
+    3, 280, 264, 282,
+    3, 270, 245, 266,
+    3, 270, 266, 229,
+    3, 222, 268, 216,
+    3, 222, 216, 235,
+    3, 240, 252, 248,
+    3, 240, 248, 241,
+    3, 260, 248, 252,
+    3, 260, 252, 286,
+    3, 267, 247, 274,
+    3, 267, 274, 269,
+    3, 286, 252, 247,
+    3, 286, 247, 267,
+    3, 239, 242, 260,
+    3, 239, 260, 286,
+    3, 266, 239, 286,
+    3, 266, 286, 267,
+    3, 238, 237, 249,
+    3, 238, 249, 248,
+    3, 229, 267, 228,
+    3, 229, 228, 213,
+    3, 244, 263, 216,
+    3, 244, 216, 215,
+    3, 217, 216, 268,
+    3, 217, 268, 284,
+    3, 283, 218, 227,
+    3, 283, 227, 226,
+    3, 288, 276, 275,
+    3, 288, 275, 287,
+    3, 256, 289, 290,
+    3, 256, 290, 251,
+    3, 251, 290, 192,
+    3, 251, 192, 137,
+    3, 276, 288, 291,
+    3, 276, 291, 277,
+    3, 277, 291, 289,
+    3, 277, 289, 256,
+    3, 291, 292, 293,
+    3, 291, 293, 289,
+    3, 290, 294, 196,
+    3, 290, 196, 192,
+    3, 289, 293, 294,
+    3, 289, 294, 290,
+    3, 288, 287, 292,
+    3, 288, 292, 291,
+    3, 294, 296, 199,
+    3, 294, 199, 196,
+    3, 292, 295, 297,
+    3, 292, 297, 293,
+    3, 293, 297, 296,
+    3, 293, 296, 294,
+    3, 295, 203, 202,
+    3, 295, 202, 297,
+    3, 226, 109, 203,
+    3, 226, 203, 295,
+    3, 263, 262, 272,
+    3, 263, 272, 233,
 };
 
 int main(int argc, char *argv[]) {
@@ -2054,37 +935,22 @@ POKE(0xD00F,0x00);
 	
 	bitmapSetVisible(0, true);
 
-float scale = 45.0;
+// A distant camera with a long focal length keeps the original
+// near-flat front view at 45 pixels per unit.
+meshT skull;
 
-uint16_t sizeVerts =  sizeof(scene_vertices)/sizeof(scene_vertices[0]);
-uint16_t sizeIndices = sizeof(scene_indices)/sizeof(scene_indices[0]);
+	meshSetProjection(160, 120, 360);
+	meshSetPosition(0, 0, 2048);
+	meshSetRotation(0, 0, 0);
 
-	printf("allo %d",sizeVerts);
-
-for(uint16_t i=0;i<sizeIndices;i+=3)
-{
-		uint16_t i1 = scene_indices[i];
-		uint16_t i2 = scene_indices[i+1];
-		uint16_t i3 = scene_indices[i+2];
-	
-	bitmapLine(160+(uint16_t)(int16_t)(scene_vertices[i1]*scale), 
-	           120+(uint16_t)(int16_t)(scene_vertices[i1+1]*scale),
-			   160+(uint16_t)(int16_t)(scene_vertices[i2]*scale), 
-			   120+(uint16_t)(int16_t)(scene_vertices[i2+1]*scale)
-			   );
-	bitmapLine(160+(uint16_t)(int16_t)(scene_vertices[i2]*scale), 
-	           120+(uint16_t)(int16_t)(scene_vertices[i2+1]*scale),
-			   160+(uint16_t)(int16_t)(scene_vertices[i3]*scale), 
-			   120+(uint16_t)(int16_t)(scene_vertices[i3+1]*scale)
-			   );
-	bitmapLine(160+(uint16_t)(int16_t)(scene_vertices[i3]*scale), 
-	           120+(uint16_t)(int16_t)(scene_vertices[i3+1]*scale),
-			   160+(uint16_t)(int16_t)(scene_vertices[i1]*scale), 
-			   120+(uint16_t)(int16_t)(scene_vertices[i1+1]*scale)
-			   );
-	i+=3;
-	if(i>(sizeVerts-3)) break;
-}
+	// Every face is a triangle: a count and three vertex indices.
+	if (meshInit(&skull, scene_vertices, sizeof(scene_vertices) / sizeof(scene_vertices[0]),
+	             scene_faces, sizeof(scene_faces) / (4 * sizeof(scene_faces[0]))))
+	{
+		// Each shared edge is drawn once.
+		meshTransform(&skull);
+		meshDraw(&skull, false);
+	}
 
 while(true)
 	{
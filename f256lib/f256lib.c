@@ -5,6 +5,7 @@
 
 
 #include "f256lib.h"
+#include <string.h>
 
 
 void f256Init(void) {
@@ -40,9 +41,15 @@ void f256Init(void) {
 #ifndef WITHOUT_TILE
 	tileReset();
 #endif
+#ifndef WITHOUT_CAMERA
+	cameraReset();
+#endif
 #ifndef WITHOUT_SPRITE
 	spriteReset();
 #endif
+#ifndef WITHOUT_COLLIDE
+	collideReset();
+#endif
 #ifndef WITHOUT_FILE
 	fileReset();
 #endif
@@ -148,6 +155,150 @@ void FAR_POKEW(uint32_t address, uint16_t value) {
 }
 
 
+void farMemcpy(uint32_t dest, const void *src, uint32_t length) {
+	const byte *s      = (const byte *)src;
+	byte        block  = dest / EIGHTK;
+	uint16_t    offset = dest & 0x1FFF;
+	uint16_t    chunk;
+
+	while (length) {
+		chunk = EIGHTK - offset;
+		if (chunk > FAR_CHUNK_SIZE) chunk = FAR_CHUNK_SIZE;
+		if (chunk > length) chunk = length;
+
+		{
+			SWAP_IO_SETUP();
+			POKE_MEMMAP(SWAP_SLOT, block);
+			memcpy((byte *)(SWAP_ADDR + offset), s, chunk);
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+
+		s      += chunk;
+		length -= chunk;
+		offset += chunk;
+		if (offset == EIGHTK) {
+			offset = 0;
+			block++;
+		}
+	}
+}
+
+
+void farMemcpyNear(void *dest, uint32_t src, uint32_t length) {
+	byte     *d      = (byte *)dest;
+	byte      block  = src / EIGHTK;
+	uint16_t  offset = src & 0x1FFF;
+	uint16_t  chunk;
+
+	while (length) {
+		chunk = EIGHTK - offset;
+		if (chunk > FAR_CHUNK_SIZE) chunk = FAR_CHUNK_SIZE;
+		if (chunk > length) chunk = length;
+
+		{
+			SWAP_IO_SETUP();
+			POKE_MEMMAP(SWAP_SLOT, block);
+			memcpy(d, (byte *)(SWAP_ADDR + offset), chunk);
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+
+		d      += chunk;
+		length -= chunk;
+		offset += chunk;
+		if (offset == EIGHTK) {
+			offset = 0;
+			block++;
+		}
+	}
+}
+
+
+void farMemset(uint32_t dest, byte value, uint32_t length) {
+	byte     block  = dest / EIGHTK;
+	uint16_t offset = dest & 0x1FFF;
+	uint16_t chunk;
+
+	while (length) {
+		chunk = EIGHTK - offset;
+		if (chunk > FAR_CHUNK_SIZE) chunk = FAR_CHUNK_SIZE;
+		if (chunk > length) chunk = length;
+
+		{
+			SWAP_IO_SETUP();
+			POKE_MEMMAP(SWAP_SLOT, block);
+			memset((byte *)(SWAP_ADDR + offset), value, chunk);
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+
+		length -= chunk;
+		offset += chunk;
+		if (offset == EIGHTK) {
+			offset = 0;
+			block++;
+		}
+	}
+}
+
+
+// Copies forward, so overlapping ranges are only safe when dest < src.
+#ifdef SWAP_SLOT2
+void farToFar(uint32_t dest, uint32_t src, uint32_t length) {
+	byte     dBlock  = dest / EIGHTK;
+	byte     sBlock  = src / EIGHTK;
+	uint16_t dOffset = dest & 0x1FFF;
+	uint16_t sOffset = src & 0x1FFF;
+	uint16_t chunk;
+
+	while (length) {
+		chunk = EIGHTK - dOffset;
+		if (EIGHTK - sOffset < chunk) chunk = EIGHTK - sOffset;
+		if (chunk > FAR_CHUNK_SIZE) chunk = FAR_CHUNK_SIZE;
+		if (chunk > length) chunk = length;
+
+		{
+			SWAP_IO_SETUP();
+			SWAP2_SETUP();
+			POKE_MEMMAP(SWAP_SLOT, dBlock);
+			POKE_MEMMAP(SWAP_SLOT2, sBlock);
+			memcpy((byte *)(SWAP_ADDR + dOffset), (byte *)(SWAP_ADDR2 + sOffset), chunk);
+			SWAP2_SHUTDOWN();
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+
+		length  -= chunk;
+		dOffset += chunk;
+		sOffset += chunk;
+		if (dOffset == EIGHTK) {
+			dOffset = 0;
+			dBlock++;
+		}
+		if (sOffset == EIGHTK) {
+			sOffset = 0;
+			sBlock++;
+		}
+	}
+}
+#else
+void farToFar(uint32_t dest, uint32_t src, uint32_t length) {
+	static byte bounce[FAR_BOUNCE_SIZE];
+	uint16_t    chunk;
+
+	while (length) {
+		chunk = length > FAR_BOUNCE_SIZE ? FAR_BOUNCE_SIZE : (uint16_t)length;
+		farMemcpyNear(bounce, src, chunk);
+		farMemcpy(dest, bounce, chunk);
+		dest   += chunk;
+		src    += chunk;
+		length -= chunk;
+	}
+}
+#endif
+
+
 #ifndef WITHOUT_MAIN
 // Undo the main→f256main rename for this wrapper
 #ifdef main
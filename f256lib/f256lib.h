@@ -107,6 +107,16 @@ struct __memmap_byte { volatile __memmap byte v; };
 #define WITHOUT_BITMAP
 #define WITHOUT_TILE
 #define WITHOUT_SPRITE
+#define WITHOUT_PALETTE
+#define WITHOUT_RASTER
+#endif
+
+#ifdef WITHOUT_BITMAP
+#define WITHOUT_MESH
+#endif
+
+#ifdef WITHOUT_TILE
+#define WITHOUT_CAMERA
 #endif
 
 #ifdef WITHOUT_KERNEL
@@ -122,6 +132,9 @@ struct __memmap_byte { volatile __memmap byte v; };
 #ifdef WITHOUT_MATH
 #define WITHOUT_TEXT
 #define WITHOUT_PLATFORM
+#define WITHOUT_MESH
+#define WITHOUT_CAMERA
+#define WITHOUT_PALETTE
 #endif
 
 
@@ -167,6 +180,46 @@ struct __memmap_byte { volatile __memmap byte v; };
 
 #define SWAP_ADDR  ((uint16_t)(SWAP_SLOT - MMU_MEM_BANK_0) * (uint16_t)0x2000)
 
+// Optional second window for far-to-far copies (farToFar, keyed bitmap
+// blits, tile streaming).  It is off by default: every slot other than
+// SWAP_SLOT normally holds program code or data.  Define SWAP_SLOT2 to a
+// slot whose contents are never touched by the copy loops or by any
+// interrupt handler to map source and destination side by side.
+// Without it those copies bounce through a FAR_BOUNCE_SIZE byte buffer
+// in near memory, one window at a time.
+//
+// SWAP2_SETUP() saves the slot and masks interrupts while it is swapped
+// out.  Use it (and SWAP2_SHUTDOWN()) inside SWAP_IO_SETUP() /
+// SWAP_IO_SHUTDOWN(), which unmasks them again when SWAP_SLOT is bank 7.
+#ifdef SWAP_SLOT2
+
+#define SWAP_ADDR2  ((uint16_t)(SWAP_SLOT2 - MMU_MEM_BANK_0) * (uint16_t)0x2000)
+
+#define SWAP2_SETUP() \
+	byte sios_ram2 = PEEK(SWAP_SLOT2); \
+	__asm volatile { sei }
+
+#if SWAP_SLOT == MMU_MEM_BANK_7
+#define SWAP2_SHUTDOWN() \
+	POKE_MEMMAP(SWAP_SLOT2, sios_ram2)
+#else
+#define SWAP2_SHUTDOWN() \
+	POKE_MEMMAP(SWAP_SLOT2, sios_ram2); \
+	__asm volatile { cli }
+#endif
+
+#endif
+
+#ifndef FAR_BOUNCE_SIZE
+#define FAR_BOUNCE_SIZE  64
+#endif
+
+// Most bytes the far block transfers move per mapping.  Interrupts are
+// masked while a window is swapped in, so this bounds their latency.
+#ifndef FAR_CHUNK_SIZE
+#define FAR_CHUNK_SIZE   256
+#endif
+
 
 // ============================================================
 // Module headers (each triggers #pragma compile for its .c file)
@@ -178,9 +231,14 @@ struct __memmap_byte { volatile __memmap byte v; };
 #include "f_random.h"
 #include "f_text.h"
 #include "f_bitmap.h"
+#include "f_mesh.h"
 #include "f_tile.h"
+#include "f_camera.h"
 #include "f_graphics.h"
+#include "f_palette.h"
+#include "f_raster.h"
 #include "f_sprite.h"
+#include "f_collide.h"
 #include "f_keyboard.h"
 #include "f_midi.h"
 #include "f_sid.h"
@@ -216,6 +274,12 @@ void     *FAR_POINTER(uint32_t address);
 void      FAR_POKE(uint32_t address, byte value);
 void      FAR_POKEW(uint32_t address, uint16_t value);
 
+// Block transfers: map each 8K block once instead of once per byte.
+void      farMemcpy(uint32_t dest, const void *src, uint32_t length);
+void      farMemcpyNear(void *dest, uint32_t src, uint32_t length);
+void      farMemset(uint32_t dest, byte value, uint32_t length);
+void      farToFar(uint32_t dest, uint32_t src, uint32_t length);
+
 
 // ============================================================
 // Auto-init: rename main to f256main so f256lib.c can wrap it
@@ -8,6 +8,21 @@
 
 
 #include "f256lib.h"
+#include <string.h>
+
+
+// Rows per page in the row tables.  Only 320x240 is supported.
+#define BITMAP_ROWS  240
+
+// Dirty rectangles remembered per page before they start to merge.
+#ifndef BITMAP_DIRTY_RECTS
+#define BITMAP_DIRTY_RECTS  4
+#endif
+
+// Filled rectangles of at least this many pixels go to the DMA engine.
+#ifndef BITMAP_DMA_MIN
+#define BITMAP_DMA_MIN  1024
+#endif
 
 
 static uint16_t _MAX_X;
@@ -18,39 +33,517 @@ static byte     _BITMAP_CLUT[3];
 static byte     _color;
 static byte     _active;
 
+// Per-page row start, split into 8K block and offset within the block.
+static byte     _rowBlock[3][BITMAP_ROWS];
+static uint16_t _rowOffset[3][BITMAP_ROWS];
+static byte     *_rowBlk = _rowBlock[0];   // Active page.
+static uint16_t *_rowOff = _rowOffset[0];
+
 
 // Replaced GCC statement expression with a do/while macro.
 // Must only be used as a statement (not an expression).
+// The row offset is below 8K and x below 320, so the sum stays in 16 bits.
 #define bitmapPutPixelIOSet(px, py) do { \
-	uint32_t _bpp_address = _BITMAP_BASE[_active] + mathUnsignedAddition(mathUnsignedMultiply((py), _MAX_X), (int32_t)(px)); \
-	byte     _bpp_block   = _bpp_address / EIGHTK; \
-	_bpp_address &= 0x1FFF; \
-	POKE_MEMMAP(SWAP_SLOT, _bpp_block); \
-	POKE(SWAP_ADDR + _bpp_address, _color); \
+	uint16_t _bpp_offset = _rowOff[(py)] + (px); \
+	POKE_MEMMAP(SWAP_SLOT, _rowBlk[(py)] + (byte)(_bpp_offset >> 13)); \
+	POKE(SWAP_ADDR + (_bpp_offset & 0x1FFF), _color); \
 } while(0)
 
 
+static void bitmapBuildRows(byte p) {
+	byte     block  = _BITMAP_BASE[p] / EIGHTK;
+	uint16_t offset = _BITMAP_BASE[p] & 0x1FFF;
+	byte     y;
+
+	for (y=0; y<BITMAP_ROWS; y++) {
+		_rowBlock[p][y]  = block;
+		_rowOffset[p][y] = offset;
+		offset += _MAX_X;
+		if (offset >= EIGHTK) {
+			offset -= EIGHTK;
+			block++;
+		}
+	}
+}
+
+
+// Block currently mapped into SWAP_SLOT during a span fill, or 0xff.
+static byte _mapped;
+
+// Page flipping.  Pages are indexes into _BITMAP_BASE; 0xff means none.
+static byte _flipLayer   = 0;     // Hardware layer showing the front page.
+static byte _flipPages   = 1;     // 1 = off, 2 = double, 3 = triple.
+static byte _front       = 0;
+static byte _pending     = 0xff;  // Finished page waiting for vertical blank.
+static byte _clearMode   = BITMAP_CLEAR_NONE;
+static byte _clearColor  = 0;
+
+// Dirty rectangles (inclusive, clipped to the screen) drawn on each page.
+typedef struct bitmapRectS {
+	int16_t x1;
+	int16_t y1;
+	int16_t x2;
+	int16_t y2;
+} bitmapRectT;
+
+static bitmapRectT _dirty[3][BITMAP_DIRTY_RECTS];
+static byte        _dirtyCount[3];
+static bool        _dirtyTrack      = false;
+static uint32_t    _dirtyBackground = 0;   // Restore source, 0 = fill instead.
+
+#define bitmapDirty(x1, y1, x2, y2) do { \
+	if (_dirtyTrack) bitmapMarkDirty((x1), (y1), (x2), (y2)); \
+} while(0)
+
+
+static void bitmapWriteAddress(byte layer, uint32_t a) {
+	switch (layer) {
+		case 0:
+			POKEA(VKY_BM0_ADDR_L, a);
+			break;
+		case 1:
+			POKEA(VKY_BM1_ADDR_L, a);
+			break;
+		case 2:
+			POKEA(VKY_BM2_ADDR_L, a);
+			break;
+	}
+}
+
+
+// Fill the clipped run x1..x2 (inclusive, either order) of row y.
+// Caller has done SWAP_IO_SETUP() and reset _mapped.
+static void bitmapSpanIOSet(int16_t x1, int16_t x2, int16_t y) {
+	int16_t  t;
+	uint16_t offset;
+	uint16_t length;
+	uint16_t chunk;
+	byte     block;
+
+	if (y < 0 || y >= (int16_t)_MAX_Y) return;
+	if (x1 > x2) {
+		t  = x1;
+		x1 = x2;
+		x2 = t;
+	}
+	if (x2 < 0 || x1 >= (int16_t)_MAX_X) return;
+	if (x1 < 0) x1 = 0;
+	if (x2 >= (int16_t)_MAX_X) x2 = _MAX_X - 1;
+
+	offset = _rowOff[y] + x1;
+	block  = _rowBlk[y] + (byte)(offset >> 13);
+	offset &= 0x1FFF;
+	length = x2 - x1 + 1;
+
+	chunk = EIGHTK - offset;
+	if (chunk > length) chunk = length;
+	if (block != _mapped) {
+		_mapped = block;
+		POKE_MEMMAP(SWAP_SLOT, block);
+	}
+	memset((byte *)(SWAP_ADDR + offset), _color, chunk);
+
+	if (length > chunk) {
+		_mapped = ++block;
+		POKE_MEMMAP(SWAP_SLOT, block);
+		memset((byte *)SWAP_ADDR, _color, length - chunk);
+	}
+}
+
+
+// Copy one row from far memory to far memory, skipping pixels equal to
+// key.  The source is mapped through the second swap window if there is
+// one, otherwise it is read a chunk at a time into near memory.
+#ifdef SWAP_SLOT2
+static void bitmapBlitKeyedRow(uint32_t dest, uint32_t src, uint16_t length, byte key) {
+	byte     dBlock  = dest / EIGHTK;
+	byte     sBlock  = src / EIGHTK;
+	uint16_t dOffset = dest & 0x1FFF;
+	uint16_t sOffset = src & 0x1FFF;
+	uint16_t chunk;
+	uint16_t i;
+	byte     *d;
+	byte     *s;
+	byte     c;
+
+	SWAP_IO_SETUP();
+	SWAP2_SETUP();
+
+	while (length) {
+		chunk = EIGHTK - dOffset;
+		if (EIGHTK - sOffset < chunk) chunk = EIGHTK - sOffset;
+		if (chunk > length) chunk = length;
+
+		POKE_MEMMAP(SWAP_SLOT, dBlock);
+		POKE_MEMMAP(SWAP_SLOT2, sBlock);
+		d = (byte *)(SWAP_ADDR + dOffset);
+		s = (byte *)(SWAP_ADDR2 + sOffset);
+		for (i=0; i<chunk; i++) {
+			c = s[i];
+			if (c != key) d[i] = c;
+		}
+
+		length  -= chunk;
+		dOffset += chunk;
+		sOffset += chunk;
+		if (dOffset == EIGHTK) {
+			dOffset = 0;
+			dBlock++;
+		}
+		if (sOffset == EIGHTK) {
+			sOffset = 0;
+			sBlock++;
+		}
+	}
+
+	SWAP2_SHUTDOWN();
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+#else
+static void bitmapBlitKeyedRow(uint32_t dest, uint32_t src, uint16_t length, byte key) {
+	static byte row[FAR_BOUNCE_SIZE];
+	byte        block;
+	uint16_t    offset;
+	uint16_t    chunk;
+	uint16_t    i;
+	byte        *d;
+	byte        c;
+
+	while (length) {
+		block  = dest / EIGHTK;
+		offset = dest & 0x1FFF;
+		chunk  = EIGHTK - offset;
+		if (chunk > FAR_BOUNCE_SIZE) chunk = FAR_BOUNCE_SIZE;
+		if (chunk > length) chunk = length;
+
+		farMemcpyNear(row, src, chunk);
+		{
+			SWAP_IO_SETUP();
+			POKE_MEMMAP(SWAP_SLOT, block);
+			d = (byte *)(SWAP_ADDR + offset);
+			for (i=0; i<chunk; i++) {
+				c = row[i];
+				if (c != key) d[i] = c;
+			}
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+
+		dest   += chunk;
+		src    += chunk;
+		length -= chunk;
+	}
+}
+#endif
+
+
+// Copy a w x h image from far memory (rows srcStride bytes apart) to
+// x,y on the active page, clipped to the screen.  Pixels equal to
+// transparent are skipped; pass BITMAP_BLIT_OPAQUE to copy everything,
+// which goes through the 2D DMA engine when it is available.
+void bitmapBlit(uint32_t src, uint16_t srcStride, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t transparent) {
+	int16_t  x2;
+	int16_t  y2;
+	uint32_t dest;
+
+	if (w == 0 || h == 0) return;
+
+	x2 = x + (int16_t)w - 1;
+	y2 = y + (int16_t)h - 1;
+	if (x2 < 0 || y2 < 0 || x >= (int16_t)_MAX_X || y >= (int16_t)_MAX_Y) return;
+	if (x < 0) {
+		src -= x;
+		x = 0;
+	}
+	if (y < 0) {
+		src += mathUnsignedMultiply(-y, srcStride);
+		y = 0;
+	}
+	if (x2 >= (int16_t)_MAX_X) x2 = _MAX_X - 1;
+	if (y2 >= (int16_t)_MAX_Y) y2 = _MAX_Y - 1;
+	w = x2 - x + 1;
+	h = y2 - y + 1;
+
+	bitmapDirty(x, y, x2, y2);
+
+	if (transparent == BITMAP_BLIT_OPAQUE) {
+#ifndef WITHOUT_DMA
+		dest = ((uint32_t)_rowBlk[y] << 13) + _rowOff[y] + x;
+		dmaQueue2dCopy(dest, src, w, h, srcStride, _MAX_X, DMA_SYNC);
+#else
+		for (; y <= y2; y++) {
+			farToFar(((uint32_t)_rowBlk[y] << 13) + _rowOff[y] + x, src, w);
+			src += srcStride;
+		}
+#endif
+		return;
+	}
+
+	for (; y <= y2; y++) {
+		dest = ((uint32_t)_rowBlk[y] << 13) + _rowOff[y] + x;
+		bitmapBlitKeyedRow(dest, src, w, (byte)transparent);
+		src += srcStride;
+	}
+}
+
+
 void bitmapClear(void) {
 #ifdef BOOM
 	dmaFill(_BITMAP_BASE[_active], _PAGE_SIZE, _color);
 #else
-	byte     block = _BITMAP_BASE[_active] / EIGHTK;
-	byte     x;
-	uint16_t c;
-	volatile byte *mem = (byte *)SWAP_ADDR;
+	farMemset(_BITMAP_BASE[_active], _color, _PAGE_SIZE);
+#endif
+	_dirtyCount[_active] = 0;
+}
+
+
+// Clear (or restore from the background image) only what was drawn on
+// the active page since its last clear.  Rectangles go through the DMA
+// queue; any that don't fit in it are done by the CPU instead.
+void bitmapClearDirty(void) {
+	bitmapRectT *r = _dirty[_active];
+	byte         i;
+	int16_t      y;
+	uint16_t     w;
+	uint16_t     h;
+	uint32_t     dest;
+	uint32_t     src;
+
+#ifndef WITHOUT_DMA
+	dmaWait();
+#endif
+
+	for (i=0; i<_dirtyCount[_active]; i++, r++) {
+		w    = r->x2 - r->x1 + 1;
+		h    = r->y2 - r->y1 + 1;
+		dest = ((uint32_t)_rowBlk[r->y1] << 13) + _rowOff[r->y1] + r->x1;
+		if (_dirtyBackground) {
+			src = _dirtyBackground + mathUnsignedMultiply(r->y1, _MAX_X) + r->x1;
+#ifndef WITHOUT_DMA
+			if (dmaQueue2dCopy(dest, src, w, h, _MAX_X, _MAX_X, DMA_NOWAIT)) continue;
+#endif
+			for (y=r->y1; y<=r->y2; y++) {
+				farToFar(((uint32_t)_rowBlk[y] << 13) + _rowOff[y] + r->x1, src, w);
+				src += _MAX_X;
+			}
+		} else {
+#ifndef WITHOUT_DMA
+			if (dmaQueue2dFill(dest, w, h, _MAX_X, _color, DMA_NOWAIT)) continue;
+#endif
+			SWAP_IO_SETUP();
+			_mapped = 0xff;
+			for (y=r->y1; y<=r->y2; y++) bitmapSpanIOSet(r->x1, r->x2, y);
+			SWAP_RESTORE_SLOT();
+			SWAP_IO_SHUTDOWN();
+		}
+	}
+#ifndef WITHOUT_DMA
+	dmaWait();
+#endif
+
+	_dirtyCount[_active] = 0;
+}
+
+
+void bitmapFillCircle(int16_t cx, int16_t cy, uint16_t r) {
+	int16_t x   = r;
+	int16_t y   = 0;
+	int16_t err = 1 - (int16_t)r;
+
+	bitmapDirty(cx - x, cy - x, cx + x, cy + x);
+
+	SWAP_IO_SETUP();
+	_mapped = 0xff;
+
+	// Midpoint circle.  Rows cy+-y are filled every step; rows cy+-x only
+	// once, just before x moves inward, when their width is final.
+	while (x >= y) {
+		bitmapSpanIOSet(cx - x, cx + x, cy + y);
+		if (y != 0) bitmapSpanIOSet(cx - x, cx + x, cy - y);
+		if (err >= 0) {
+			if (x != y) {
+				bitmapSpanIOSet(cx - y, cx + y, cy + x);
+				bitmapSpanIOSet(cx - y, cx + y, cy - x);
+			}
+			x--;
+			err += (y - x) * 2 + 3;
+		} else {
+			err += y * 2 + 3;
+		}
+		y++;
+	}
+
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+
+
+void bitmapFillRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+	int16_t x2 = x + (int16_t)w - 1;
+	int16_t y2 = y + (int16_t)h - 1;
+
+	if (w == 0 || h == 0) return;
+	if (x < 0) x = 0;
+	if (y < 0) y = 0;
+	if (x2 >= (int16_t)_MAX_X) x2 = _MAX_X - 1;
+	if (y2 >= (int16_t)_MAX_Y) y2 = _MAX_Y - 1;
+	if (x > x2 || y > y2) return;
+
+	bitmapDirty(x, y, x2, y2);
+
+#ifndef WITHOUT_DMA
+	w = x2 - x + 1;
+	h = y2 - y + 1;
+	if (mathUnsignedMultiply(w, h) >= BITMAP_DMA_MIN) {
+		// Start immediately (the CPU would not wait for VBL either) and let
+		// the transfer finish before any later CPU drawing.
+		dmaQueue2dFill(((uint32_t)_rowBlk[y] << 13) + _rowOff[y] + x, w, h, _MAX_X, _color, DMA_SYNC);
+		return;
+	}
+#endif
 
 	SWAP_IO_SETUP();
+	_mapped = 0xff;
+	for (; y <= y2; y++) bitmapSpanIOSet(x, x2, y);
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+
 
-	for (x=0; x<9; x++) {
-		POKE_MEMMAP(SWAP_SLOT, block++);
-		for (c=0; c<EIGHTK; c++) mem[c] = _color;
+void bitmapFillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3) {
+	int16_t t;
+	int16_t y;
+	int32_t xl;   // Long edge (1 -> 3), 16.16 fixed point.
+	int32_t xs;   // Short edges (1 -> 2, then 2 -> 3).
+	int32_t dl;
+	int32_t ds;
+
+	// Sort vertices by y.
+	if (y1 > y2) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+	if (y2 > y3) { t = x2; x2 = x3; x3 = t; t = y2; y2 = y3; y3 = t; }
+	if (y1 > y2) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+
+	if (y3 < 0 || y1 >= (int16_t)_MAX_Y) return;
+
+	if (_dirtyTrack) {
+		t = x1;
+		if (x2 < t) t = x2;
+		if (x3 < t) t = x3;
+		y = x1;
+		if (x2 > y) y = x2;
+		if (x3 > y) y = x3;
+		bitmapMarkDirty(t, y1, y, y3);
+	}
+
+	SWAP_IO_SETUP();
+	_mapped = 0xff;
+
+	if (y1 == y3) {
+		t = x1;
+		if (x2 < t) t = x2;
+		if (x3 < t) t = x3;
+		y = x1;
+		if (x2 > y) y = x2;
+		if (x3 > y) y = x3;
+		bitmapSpanIOSet(t, y, y1);
+	} else {
+		xl = ((int32_t)x1 << 16) + 0x8000;
+		dl = ((int32_t)(x3 - x1) << 16) / (y3 - y1);
+
+		xs = xl;
+		if (y2 > y1) {
+			ds = ((int32_t)(x2 - x1) << 16) / (y2 - y1);
+			for (y = y1; y < y2 && y < (int16_t)_MAX_Y; y++) {
+				bitmapSpanIOSet((int16_t)(xl >> 16), (int16_t)(xs >> 16), y);
+				xl += dl;
+				xs += ds;
+			}
+			xl = ((int32_t)x1 << 16) + 0x8000 + dl * (y2 - y1);
+		}
+
+		xs = ((int32_t)x2 << 16) + 0x8000;
+		ds = (y3 > y2) ? ((int32_t)(x3 - x2) << 16) / (y3 - y2) : 0;
+		for (y = y2; y <= y3 && y < (int16_t)_MAX_Y; y++) {
+			bitmapSpanIOSet((int16_t)(xl >> 16), (int16_t)(xs >> 16), y);
+			xl += dl;
+			xs += ds;
+		}
 	}
-	POKE_MEMMAP(SWAP_SLOT, block);
-	for (c=0; c<5120; c++) mem[c] = _color;
 
 	SWAP_RESTORE_SLOT();
 	SWAP_IO_SHUTDOWN();
+}
+
+
+// Hand the active page to the display and move drawing to a free page.
+// With three pages this never waits.  With two, the only other page is
+// still on screen until the swap latches, so it waits for vertical blank.
+void bitmapFlip(void) {
+	byte next;
+	byte c;
+
+	if (_flipPages < 2) return;
+
+	if (_flipPages == 2) {
+		while (bitmapFlipService());
+		_pending = _active;
+		next     = _front;
+		while (bitmapFlipService());
+	} else {
+		bitmapFlipService();
+		if (_pending != 0xff) {
+			// The previous frame is still waiting for vertical blank; drop
+			// it and draw into its page instead of waiting.
+			next = _pending;
+		} else {
+			next = 3 - _front - _active;
+		}
+		_pending = _active;
+		bitmapFlipService();
+	}
+
+	bitmapSetActive(next);
+
+	if (_clearMode == BITMAP_CLEAR_FULL) {
+#ifndef WITHOUT_DMA
+		// The new back page is not visible, so there is no need to wait for
+		// VBL.
+		dmaQueueFill(_BITMAP_BASE[next], _PAGE_SIZE, _clearColor, DMA_SYNC);
+#else
+		c      = _color;
+		_color = _clearColor;
+		bitmapClear();
+		_color = c;
 #endif
+		_dirtyCount[next] = 0;
+	} else if (_clearMode == BITMAP_CLEAR_DIRTY) {
+		c      = _color;
+		_color = _clearColor;
+		bitmapClearDirty();
+		_color = c;
+	}
+}
+
+
+// Latch a pending flip if the raster is in vertical blank (rows 480 and
+// up), so the swap never tears.  With three pages bitmapFlip() doesn't
+// wait, so call this often enough to catch the blank (every pass of the
+// main loop); returns true while a flip is still waiting.
+bool bitmapFlipService(void) {
+	if (_pending == 0xff) return false;
+	if (PEEKW(RAST_ROW_L) < 480) return true;
+
+	bitmapWriteAddress(_flipLayer, _BITMAP_BASE[_pending]);
+	_front   = _pending;
+	_pending = 0xff;
+
+	return false;
+}
+
+
+byte bitmapGetActive(void) {
+	return _active;
 }
 
 
@@ -60,16 +553,32 @@ void bitmapGetResolution(uint16_t *x, uint16_t *y) {
 }
 
 
-void bitmapLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-	uint16_t x;
-	uint16_t y;
-	int16_t  dx;
-	int16_t  dy;
-	int16_t  incX;
-	int16_t  incY;
-	int16_t  balance;
-
+void bitmapHLine(int16_t x1, int16_t x2, int16_t y) {
+	bitmapDirty(x1, y, x2, y);
 	SWAP_IO_SETUP();
+	_mapped = 0xff;
+	bitmapSpanIOSet(x1, x2, y);
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+
+
+// Bresenham, stepping the window offset directly.  The MMU slot is only
+// rewritten when the offset crosses into the next or previous 8K block.
+void bitmapLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+	int16_t        dx;
+	int16_t        dy;
+	int16_t        incX;
+	int16_t        stepY;
+	int16_t        major;
+	int16_t        minor;
+	int16_t        stepMajor;
+	int16_t        stepMinor;
+	int16_t        balance;
+	int16_t        offset;
+	int16_t        n;
+	byte           block;
+	volatile byte *mem = (byte *)SWAP_ADDR;
 
 	if (x2 >= x1) {
 		dx = x2 - x1;
@@ -81,43 +590,55 @@ void bitmapLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
 
 	if (y2 >= y1) {
 		dy = y2 - y1;
-		incY = 1;
+		stepY = _MAX_X;
 	} else {
 		dy = y1 - y2;
-		incY = -1;
+		stepY = -(int16_t)_MAX_X;
 	}
 
-	x = x1;
-	y = y1;
-
 	if (dx >= dy) {
-		dy <<= 1;
-		balance = dy - dx;
-		dx <<= 1;
-		while (x != x2) {
-			bitmapPutPixelIOSet(x, y);
-			if (balance >= 0) {
-				y += incY;
-				balance -= dx;
-			}
-			balance += dy;
-			x += incX;
-		}
-		bitmapPutPixelIOSet(x, y);
+		major     = dx;
+		minor     = dy;
+		stepMajor = incX;
+		stepMinor = stepY;
 	} else {
-		dx <<= 1;
-		balance = dx - dy;
-		dy <<= 1;
-		while (y != y2) {
-			bitmapPutPixelIOSet(x, y);
-			if (balance >= 0) {
-				x += incX;
-				balance -= dy;
-			}
-			balance += dx;
-			y += incY;
+		major     = dy;
+		minor     = dx;
+		stepMajor = stepY;
+		stepMinor = incX;
+	}
+
+	offset = _rowOff[y1] + x1;
+	block  = _rowBlk[y1];
+	if (offset >= EIGHTK) {
+		offset -= EIGHTK;
+		block++;
+	}
+
+	bitmapDirty(x1, y1, x2, y2);
+
+	minor <<= 1;
+	balance = minor - major;
+	major <<= 1;
+
+	SWAP_IO_SETUP();
+	POKE_MEMMAP(SWAP_SLOT, block);
+
+	for (n = major >> 1; n >= 0; n--) {
+		mem[offset] = _color;
+		if (balance >= 0) {
+			offset  += stepMinor;
+			balance -= major;
+		}
+		balance += minor;
+		offset  += stepMajor;
+		if (offset < 0) {
+			offset += EIGHTK;
+			POKE_MEMMAP(SWAP_SLOT, --block);
+		} else if (offset >= EIGHTK) {
+			offset -= EIGHTK;
+			POKE_MEMMAP(SWAP_SLOT, ++block);
 		}
-		bitmapPutPixelIOSet(x, y);
 	}
 
 	SWAP_RESTORE_SLOT();
@@ -125,7 +646,62 @@ void bitmapLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
 }
 
 
+// Remember that x1,y1 - x2,y2 (inclusive, any order) was drawn on the
+// active page.  When the page's list is full the new box is merged into
+// whichever existing one grows the least.
+void bitmapMarkDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+	bitmapRectT *list = _dirty[_active];
+	bitmapRectT *r;
+	bitmapRectT *best = list;
+	uint32_t     bestGrowth = 0xffffffff;
+	uint32_t     growth;
+	int16_t      t;
+	int16_t      ux1, uy1, ux2, uy2;
+	byte         i;
+
+	if (x1 > x2) { t = x1; x1 = x2; x2 = t; }
+	if (y1 > y2) { t = y1; y1 = y2; y2 = t; }
+	if (x2 < 0 || y2 < 0 || x1 >= (int16_t)_MAX_X || y1 >= (int16_t)_MAX_Y) return;
+	if (x1 < 0) x1 = 0;
+	if (y1 < 0) y1 = 0;
+	if (x2 >= (int16_t)_MAX_X) x2 = _MAX_X - 1;
+	if (y2 >= (int16_t)_MAX_Y) y2 = _MAX_Y - 1;
+
+	for (i=0, r=list; i<_dirtyCount[_active]; i++, r++) {
+		if (x1 >= r->x1 && x2 <= r->x2 && y1 >= r->y1 && y2 <= r->y2) return;
+	}
+
+	if (_dirtyCount[_active] < BITMAP_DIRTY_RECTS) {
+		r = &list[_dirtyCount[_active]++];
+		r->x1 = x1;
+		r->y1 = y1;
+		r->x2 = x2;
+		r->y2 = y2;
+		return;
+	}
+
+	for (i=0, r=list; i<BITMAP_DIRTY_RECTS; i++, r++) {
+		ux1 = x1 < r->x1 ? x1 : r->x1;
+		uy1 = y1 < r->y1 ? y1 : r->y1;
+		ux2 = x2 > r->x2 ? x2 : r->x2;
+		uy2 = y2 > r->y2 ? y2 : r->y2;
+		growth = mathUnsignedMultiply(ux2 - ux1 + 1, uy2 - uy1 + 1)
+		       - mathUnsignedMultiply(r->x2 - r->x1 + 1, r->y2 - r->y1 + 1);
+		if (growth < bestGrowth) {
+			bestGrowth = growth;
+			best       = r;
+		}
+	}
+
+	if (x1 < best->x1) best->x1 = x1;
+	if (y1 < best->y1) best->y1 = y1;
+	if (x2 > best->x2) best->x2 = x2;
+	if (y2 > best->y2) best->y2 = y2;
+}
+
+
 void bitmapPutPixel(uint16_t x, uint16_t y) {
+	bitmapDirty(x, y, x, y);
 	SWAP_IO_SETUP();
 	bitmapPutPixelIOSet(x, y);
 	SWAP_RESTORE_SLOT();
@@ -161,6 +737,19 @@ void bitmapReset(void) {
 	POKEA(VKY_BM1_ADDR_L, _BITMAP_BASE[1]);
 	POKEA(VKY_BM2_ADDR_L, _BITMAP_BASE[2]);
 
+	bitmapBuildRows(0);
+	bitmapBuildRows(1);
+	bitmapBuildRows(2);
+	bitmapSetActive(0);
+
+	_flipPages = 1;
+	_front     = 0;
+	_pending   = 0xff;
+	_clearMode = BITMAP_CLEAR_NONE;
+
+	bitmapSetDirtyTracking(false);
+	_dirtyBackground = 0;
+
 	bitmapSetVisible(0, false);
 	bitmapSetVisible(1, false);
 	bitmapSetVisible(2, false);
@@ -169,22 +758,29 @@ void bitmapReset(void) {
 
 void bitmapSetActive(byte p) {
 	_active = p;
+	_rowBlk = _rowBlock[p];
+	_rowOff = _rowOffset[p];
 }
 
 
 void bitmapSetAddress(byte p, uint32_t a) {
 	_BITMAP_BASE[p] = a;
-	switch (p) {
-		case 0:
-			POKEA(VKY_BM0_ADDR_L, a);
-			break;
-		case 1:
-			POKEA(VKY_BM1_ADDR_L, a);
-			break;
-		case 2:
-			POKEA(VKY_BM2_ADDR_L, a);
-			break;
-	}
+	bitmapBuildRows(p);
+	bitmapWriteAddress(p, a);
+}
+
+
+// Show pages 0..pages-1 in turn on one hardware layer.  Page 0 is shown
+// first and drawing starts on page 1.  pages = 1 turns flipping off.
+void bitmapSetBuffering(byte layer, byte pages) {
+	_flipLayer = layer;
+	_flipPages = pages;
+	_front     = 0;
+	_pending   = 0xff;
+
+	bitmapWriteAddress(layer, _BITMAP_BASE[0]);
+	bitmapSetVisible(layer, true);
+	bitmapSetActive(pages > 1 ? 1 : 0);
 }
 
 
@@ -210,6 +806,28 @@ void bitmapSetColor(byte c) {
 }
 
 
+// Far address of a full-page background image.  When set, dirty regions
+// are restored from it instead of filled.  0 goes back to filling.
+void bitmapSetDirtyBackground(uint32_t address) {
+	_dirtyBackground = address;
+}
+
+
+void bitmapSetDirtyTracking(bool enable) {
+	_dirtyTrack = enable;
+	_dirtyCount[0] = 0;
+	_dirtyCount[1] = 0;
+	_dirtyCount[2] = 0;
+}
+
+
+void bitmapSetFlipClear(byte mode, byte color) {
+	if (mode == BITMAP_CLEAR_DIRTY) bitmapSetDirtyTracking(true);
+	_clearMode  = mode;
+	_clearColor = color;
+}
+
+
 void bitmapSetVisible(byte p, bool v) {
 	switch (p) {
 		case 0:
@@ -12,15 +12,38 @@
 #include "f256lib.h"
 
 
+// What bitmapFlip() does to the page it hands back for drawing.
+#define BITMAP_CLEAR_NONE  0
+#define BITMAP_CLEAR_FULL  1
+#define BITMAP_CLEAR_DIRTY 2  // Only the regions drawn since the page was last cleared.
+
+// bitmapBlit() transparent index that disables color keying.
+#define BITMAP_BLIT_OPAQUE 0x100
+
+
+void bitmapBlit(uint32_t src, uint16_t srcStride, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t transparent);
 void bitmapClear(void);
+void bitmapClearDirty(void);
+void bitmapFillCircle(int16_t cx, int16_t cy, uint16_t r);
+void bitmapFillRect(int16_t x, int16_t y, uint16_t w, uint16_t h);
+void bitmapFillTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3);
+void bitmapFlip(void);
+bool bitmapFlipService(void);
+byte bitmapGetActive(void);
 void bitmapGetResolution(uint16_t *x, uint16_t *y);
+void bitmapHLine(int16_t x1, int16_t x2, int16_t y);
 void bitmapLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void bitmapMarkDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 void bitmapPutPixel(uint16_t x, uint16_t y);
 void bitmapReset(void);
 void bitmapSetActive(byte p);
 void bitmapSetAddress(byte p, uint32_t a);
+void bitmapSetBuffering(byte layer, byte pages);
 void bitmapSetCLUT(byte clut);
 void bitmapSetColor(byte c);
+void bitmapSetDirtyBackground(uint32_t address);
+void bitmapSetDirtyTracking(bool enable);
+void bitmapSetFlipClear(byte mode, byte color);
 void bitmapSetVisible(byte p, bool v);
 
 
@@ -0,0 +1,206 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef WITHOUT_CAMERA
+
+
+#include "f256lib.h"
+
+
+// One camera position in 16.16 pixels drives every layer through its own
+// speed ratio.  Layer positions are worked out when the camera moves and
+// all registers are written together in vertical blank, so layers can't
+// drift or tear against each other.
+
+typedef struct cameraLayerS {
+	bool     active;
+	fix8T    ratioX;     // 1.0 moves with the camera, 0.5 at half speed.
+	fix8T    ratioY;
+	uint16_t wrapX;      // Positions wrap at these, in pixels; 0 never wraps.
+	uint16_t wrapY;
+	uint32_t base;       // Bitmaps: address of the top row.
+	uint16_t x;          // Position to write at the next commit.
+	uint16_t y;
+} cameraLayerT;
+
+
+static cameraLayerT _layer[CAMERA_LAYERS];
+static fix16T       _cameraX = 0;
+static fix16T       _cameraY = 0;
+
+// What cameraCommit() hands to vertical blank.
+static uint16_t      _commitX[3];
+static uint16_t      _commitY[3];
+static uint32_t      _commitAddr[3];
+static byte          _commitActive;              // Bit per layer.
+static volatile bool _commitPending = false;
+
+#ifndef WITHOUT_RASTER
+static void cameraBlank(void);
+
+static const rasterClientT _cameraClient = { cameraBlank, NULL, NULL };
+#endif
+
+
+// Wraps with a signed modulo so positions left of or above the origin
+// come out right for any wrap, not just powers of two.
+static uint16_t cameraScale(fix16T p, fix8T ratio, uint16_t wrap) {
+	int16_t v = fix16ToInt(mathFix16Multiply(p, fix8ToFix16(ratio)));
+
+	if (wrap) {
+		v %= (int16_t)wrap;
+		if (v < 0) v += wrap;
+	}
+
+	return (uint16_t)v;
+}
+
+
+static void cameraUpdate(void) {
+	cameraLayerT *l;
+	byte          i;
+
+	for (i = 0; i < CAMERA_LAYERS; i++) {
+		l = &_layer[i];
+		if (!l->active) continue;
+		l->x = cameraScale(_cameraX, l->ratioX, l->wrapX);
+		l->y = cameraScale(_cameraY, l->ratioY, l->wrapY);
+	}
+}
+
+
+// Caller has mapped I/O page 0.
+static void cameraWrite(void) {
+	byte m = _commitActive;
+
+	if (m & 0x01) {
+		POKEW(VKY_TM0_POS_X_L, _commitX[0]);
+		POKEW(VKY_TM0_POS_Y_L, _commitY[0]);
+	}
+	if (m & 0x02) {
+		POKEW(VKY_TM1_POS_X_L, _commitX[1]);
+		POKEW(VKY_TM1_POS_Y_L, _commitY[1]);
+	}
+	if (m & 0x04) {
+		POKEW(VKY_TM2_POS_X_L, _commitX[2]);
+		POKEW(VKY_TM2_POS_Y_L, _commitY[2]);
+	}
+	if (m & 0x08) POKEA(VKY_BM0_ADDR_L, _commitAddr[0]);
+	if (m & 0x10) POKEA(VKY_BM1_ADDR_L, _commitAddr[1]);
+	if (m & 0x20) POKEA(VKY_BM2_ADDR_L, _commitAddr[2]);
+
+	_commitPending = false;
+}
+
+
+#ifndef WITHOUT_RASTER
+static void cameraBlank(void) {
+	if (_commitPending) cameraWrite();
+}
+#endif
+
+
+// Write every layer's position at the next vertical blank.  With the line
+// interrupt installed (rasterInstall()) this returns at once and the
+// raster dispatcher writes them; otherwise it waits for vertical blank to
+// start.
+void cameraCommit(void) {
+	cameraLayerT *l = _layer;
+	byte          mmu;
+	byte          i;
+
+	// Positions are copied so the next move can't tear this commit.
+	__asm volatile { sei }
+	_commitActive = 0;
+	for (i = 0; i < 3; i++) {
+		_commitX[i]    = l[CAMERA_TILE(i)].x;
+		_commitY[i]    = l[CAMERA_TILE(i)].y;
+		_commitAddr[i] = l[CAMERA_BITMAP(i)].base + mathUnsignedMultiply(l[CAMERA_BITMAP(i)].y, CAMERA_BITMAP_STRIDE);
+	}
+	for (i = 0; i < CAMERA_LAYERS; i++) {
+		if (l[i].active) _commitActive |= 1 << i;
+	}
+	_commitPending = true;
+	__asm volatile { cli }
+
+#ifndef WITHOUT_RASTER
+	if (rasterInstalled() && rasterAddClient(&_cameraClient)) return;
+#endif
+
+	mmu = PEEK(MMU_IO_CTRL);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	// Wait for the edge so a late call doesn't write mid-blank.
+	while (PEEKW(RAST_ROW_L) >= 480)
+		;
+	while (PEEKW(RAST_ROW_L) < 480)
+		;
+	cameraWrite();
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+}
+
+
+void cameraMoveBy(fix16T dx, fix16T dy) {
+	cameraMoveTo(_cameraX + dx, _cameraY + dy);
+}
+
+
+void cameraMoveTo(fix16T x, fix16T y) {
+	_cameraX = x;
+	_cameraY = y;
+	cameraUpdate();
+}
+
+
+void cameraReset(void) {
+	byte i;
+
+#ifndef WITHOUT_RASTER
+	rasterRemoveClient(&_cameraClient);
+#endif
+	for (i = 0; i < CAMERA_LAYERS; i++) _layer[i].active = false;
+	_cameraX       = 0;
+	_cameraY       = 0;
+	_commitPending = false;
+}
+
+
+// Bitmaps have no scroll registers, so they only move vertically, by
+// pointing the layer at a later row of a taller image at base.  The top
+// row wraps at height - CAMERA_BITMAP_ROWS so the screen never reads past
+// the end of the image; for a seamless loop, repeat the first
+// CAMERA_BITMAP_ROWS rows at the bottom.
+void cameraSetBitmap(byte b, fix8T ratio, uint32_t base, uint16_t height) {
+	cameraLayerT *l = &_layer[CAMERA_BITMAP(b)];
+
+	l->active = true;
+	l->ratioX = 0;
+	l->ratioY = ratio;
+	l->wrapX  = 0;
+	l->wrapY  = height > CAMERA_BITMAP_ROWS ? height - CAMERA_BITMAP_ROWS : 1;
+	l->base   = base;
+	cameraUpdate();
+}
+
+
+// wrapX / wrapY are normally the map size in pixels.
+void cameraSetTile(byte t, fix8T ratioX, fix8T ratioY, uint16_t wrapX, uint16_t wrapY) {
+	cameraLayerT *l = &_layer[CAMERA_TILE(t)];
+
+	l->active = true;
+	l->ratioX = ratioX;
+	l->ratioY = ratioY;
+	l->wrapX  = wrapX;
+	l->wrapY  = wrapY;
+	cameraUpdate();
+}
+
+
+void cameraStop(byte layer) {
+	_layer[layer].active = false;
+}
+
+
+#endif
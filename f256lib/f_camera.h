@@ -0,0 +1,37 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef CAMERA_H
+#define CAMERA_H
+#ifndef WITHOUT_CAMERA
+
+
+#include "f256lib.h"
+
+
+// Layers the camera moves: the three tile maps, then the three bitmaps.
+#define CAMERA_LAYERS     6
+#define CAMERA_TILE(t)    (t)
+#define CAMERA_BITMAP(b)  (3 + (b))
+
+#define CAMERA_BITMAP_STRIDE  320   // Bytes per bitmap row.
+#define CAMERA_BITMAP_ROWS    240   // Rows on screen.
+
+
+void cameraCommit(void);
+void cameraMoveBy(fix16T dx, fix16T dy);
+void cameraMoveTo(fix16T x, fix16T y);
+void cameraReset(void);
+void cameraSetBitmap(byte b, fix8T ratio, uint32_t base, uint16_t height);
+void cameraSetTile(byte t, fix8T ratioX, fix8T ratioY, uint16_t wrapX, uint16_t wrapY);
+void cameraStop(byte layer);
+
+
+#pragma compile("f_camera.c")
+
+
+#endif
+#endif // CAMERA_H
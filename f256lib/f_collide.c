@@ -0,0 +1,188 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef WITHOUT_COLLIDE
+
+
+#include "f256lib.h"
+
+
+// Broad phase is sort and sweep on X.  Objects are kept in X order between
+// calls, so the insertion sort only moves the few that passed each other.
+// The narrow phase ANDs the rows of 1-bit masks where two objects overlap.
+
+typedef struct collideObjectS {
+	int16_t  x;
+	int16_t  y;
+	byte     width;
+	byte     height;
+	byte     layers;   // Layers the object is on.
+	byte     mask;     // Layers the object hits.
+	bool     enabled;
+	uint32_t pixels;   // Far address of the pixel mask, 0 for a solid box.
+} collideObjectT;
+
+
+static collideObjectT _object[COLLIDE_MAX];
+static byte           _order[COLLIDE_MAX];
+static uint32_t       _rowsA[COLLIDE_MASK_ROWS];
+static uint32_t       _rowsB[COLLIDE_MASK_ROWS];
+
+
+// Rows top .. top + count - 1 of an object, moved to a frame whose left
+// edge is at X.  Box objects become a run of set bits.
+static void collideRows(collideObjectT *o, int16_t x, int16_t top, byte count, uint32_t *rows) {
+	int16_t  d = o->x - x;
+	int16_t  right;
+	uint32_t span;
+	byte     r;
+
+	if (!o->pixels) {
+		right = d + o->width;
+		if (d < 0) d = 0;
+		if (right > 32) right = 32;
+		span = (0xffffffffUL >> d) & ~(right == 32 ? 0 : 0xffffffffUL >> right);
+		for (r = 0; r < count; r++) rows[r] = span;
+		return;
+	}
+
+	farMemcpyNear(rows, o->pixels + ((uint16_t)(top - o->y) << 2), (uint16_t)count << 2);
+	if (d > 0) {
+		for (r = 0; r < count; r++) rows[r] >>= d;
+	} else if (d < 0) {
+		d = -d;
+		for (r = 0; r < count; r++) rows[r] <<= d;
+	}
+}
+
+
+// Two objects interact when either one's mask includes a layer the other is on.
+static bool collideWants(collideObjectT *a, collideObjectT *b) {
+	return (a->mask & b->layers) || (b->mask & a->layers);
+}
+
+
+void collideDefine(byte n, byte width, byte height, byte layers, byte mask) {
+	_object[n].width  = width;
+	_object[n].height = height;
+	_object[n].layers = layers;
+	_object[n].mask   = mask;
+}
+
+
+void collideEnable(byte n, bool e) {
+	_object[n].enabled = e;
+}
+
+
+// Fills pairs with up to max colliding pairs, a before b in X order.
+// Returns the number of pairs found, which may be more than max.
+uint16_t collideFind(collidePairT *pairs, uint16_t max) {
+	collideObjectT *a;
+	collideObjectT *b;
+	uint16_t        found = 0;
+	int16_t         right;
+	int16_t         x;
+	byte            i;
+	byte            j;
+	byte            n;
+
+	for (i = 1; i < COLLIDE_MAX; i++) {
+		n = _order[i];
+		x = _object[n].x;
+		for (j = i; j > 0 && _object[_order[j - 1]].x > x; j--) _order[j] = _order[j - 1];
+		_order[j] = n;
+	}
+
+	for (i = 0; i < COLLIDE_MAX; i++) {
+		a = &_object[_order[i]];
+		if (!a->enabled) continue;
+		right = a->x + a->width;
+		for (j = i + 1; j < COLLIDE_MAX; j++) {
+			b = &_object[_order[j]];
+			if (b->x >= right) break;
+			if (!b->enabled || !collideWants(a, b)) continue;
+			if (b->y >= a->y + a->height || a->y >= b->y + b->height) continue;
+			if (found < max) {
+				pairs[found].a = _order[i];
+				pairs[found].b = _order[j];
+			}
+			found++;
+		}
+	}
+
+	return found;
+}
+
+
+void collideMove(byte n, int16_t x, int16_t y) {
+	_object[n].x = x;
+	_object[n].y = y;
+}
+
+
+bool collideOverlap(byte a, byte b) {
+	collideObjectT *p = &_object[a];
+	collideObjectT *q = &_object[b];
+
+	return p->enabled && q->enabled &&
+		q->x < p->x + p->width  && p->x < q->x + q->width &&
+		q->y < p->y + p->height && p->y < q->y + q->height;
+}
+
+
+// Exact test for a pair whose boxes overlap.  Objects without a mask
+// count as solid boxes.
+bool collidePixels(byte a, byte b) {
+	collideObjectT *p = &_object[a];
+	collideObjectT *q = &_object[b];
+	int16_t         top;
+	int16_t         bottom;
+	int16_t         x;
+	byte            r;
+
+	if (!collideOverlap(a, b)) return false;
+	if (!p->pixels && !q->pixels) return true;
+
+	top    = p->y > q->y ? p->y : q->y;
+	bottom = p->y + p->height < q->y + q->height ? p->y + p->height : q->y + q->height;
+	x      = p->pixels ? p->x : q->x;
+
+	collideRows(p, x, top, bottom - top, _rowsA);
+	collideRows(q, x, top, bottom - top, _rowsB);
+	for (r = 0; r < bottom - top; r++) {
+		if (_rowsA[r] & _rowsB[r]) return true;
+	}
+
+	return false;
+}
+
+
+void collideReset(void) {
+	byte i;
+
+	for (i = 0; i < COLLIDE_MAX; i++) {
+		_order[i]          = i;
+		_object[i].x       = 0;
+		_object[i].y       = 0;
+		_object[i].width   = 24;
+		_object[i].height  = 24;
+		_object[i].layers  = 1;
+		_object[i].mask    = 1;
+		_object[i].enabled = false;
+		_object[i].pixels  = 0;
+	}
+}
+
+
+// Masks hold one uint32_t per row, bit 31 the leftmost pixel, so masked
+// objects are at most 32 pixels wide and COLLIDE_MASK_ROWS high.
+void collideSetMask(byte n, uint32_t pixels) {
+	_object[n].pixels = pixels;
+}
+
+
+#endif
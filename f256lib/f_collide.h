@@ -0,0 +1,42 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef COLLIDE_H
+#define COLLIDE_H
+#ifndef WITHOUT_COLLIDE
+
+
+#include "f256lib.h"
+
+
+#ifndef COLLIDE_MAX
+#define COLLIDE_MAX  96   // Objects.
+#endif
+
+#define COLLIDE_MASK_ROWS  32
+
+
+typedef struct collidePairS {
+	byte a;
+	byte b;
+} collidePairT;
+
+
+void     collideReset(void);
+void     collideDefine(byte n, byte width, byte height, byte layers, byte mask);
+void     collideEnable(byte n, bool e);
+void     collideMove(byte n, int16_t x, int16_t y);
+bool     collideOverlap(byte a, byte b);
+bool     collidePixels(byte a, byte b);
+void     collideSetMask(byte n, uint32_t pixels);
+uint16_t collideFind(collidePairT *pairs, uint16_t max);
+
+
+#pragma compile("f_collide.c")
+
+
+#endif
+#endif // COLLIDE_H
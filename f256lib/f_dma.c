@@ -10,27 +10,46 @@
 #include "f256lib.h"
 
 
-void dmaFill(uint32_t start, uint32_t length, byte value) {
-	while (PEEKW(RAST_ROW_L) != 482); // Wait for VBL.
+typedef struct dmaJobS {
+	byte     ctrl;        // DMA_CTRL_2D / DMA_CTRL_FILL
+	byte     flags;       // DMA_WAIT_VBL
+	byte     value;
+	uint32_t src;
+	uint32_t dest;
+	uint32_t count;       // Linear jobs only.
+	uint16_t width;       // 2D jobs only.
+	uint16_t height;
+	uint16_t srcStride;
+	uint16_t destStride;
+} dmaJobT;
 
-	POKE(DMA_CTRL, DMA_CTRL_FILL | DMA_CTRL_ENABLE);
-	POKE(DMA_FILL_VAL, value);
-	POKEA(DMA_DST_ADDR, start);
-	POKEA(DMA_COUNT, length);
-	POKE(DMA_CTRL, PEEK(DMA_CTRL) | DMA_CTRL_START);
-}
 
+static dmaJobT _dmaQueue[DMA_QUEUE_SIZE];
+static byte    _dmaHead    = 0;      // Next job to start.
+static byte    _dmaTail    = 0;      // Next free slot.
+static bool    _dmaRunning = false;  // A transfer has been started and not retired.
 
-void dma2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride, byte value) {
-	while (PEEKW(RAST_ROW_L) != 482); // Wait for VBL.
 
+// Completion is polled by dmaService(), so no DMA interrupt is enabled.
+// The caller's interrupt flag is kept, so this is safe from a handler.
+static void dmaStart(const dmaJobT *job) {
+	__asm volatile { php }
 	__asm volatile { sei }
-	POKE(DMA_CTRL, DMA_CTRL_2D | DMA_CTRL_FILL | DMA_CTRL_ENABLE);
-	POKE(DMA_FILL_VAL, value);
-	POKEA(DMA_DST_ADDR, start);
-	POKEW(DMA_WIDTH, width);
-	POKEW(DMA_HEIGHT, height);
-	POKEW(DMA_STRIDE_DST, stride);
+	POKE(DMA_CTRL, job->ctrl | DMA_CTRL_ENABLE);
+	if (job->ctrl & DMA_CTRL_FILL) {
+		POKE(DMA_FILL_VAL, job->value);
+	} else {
+		POKEA(DMA_SRC_ADDR, job->src);
+	}
+	POKEA(DMA_DST_ADDR, job->dest);
+	if (job->ctrl & DMA_CTRL_2D) {
+		POKEW(DMA_WIDTH, job->width);
+		POKEW(DMA_HEIGHT, job->height);
+		POKEW(DMA_STRIDE_DST, job->destStride);
+		if (!(job->ctrl & DMA_CTRL_FILL)) POKEW(DMA_STRIDE_SRC, job->srcStride);
+	} else {
+		POKEA(DMA_COUNT, job->count);
+	}
 	POKE(DMA_CTRL, PEEK(DMA_CTRL) | DMA_CTRL_START);
 	__asm volatile { nop }
 	__asm volatile { nop }
@@ -38,7 +57,173 @@ void dma2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride,
 	__asm volatile { nop }
 	__asm volatile { nop }
 	__asm volatile { nop }
-	__asm volatile { cli }
+	__asm volatile { plp }
+
+	_dmaRunning = true;
+}
+
+
+static void dmaRun(const dmaJobT *job) {
+	dmaWait();
+	while (PEEKW(RAST_ROW_L) < 480); // Wait for VBL.
+	dmaStart(job);
+}
+
+
+static dmaJobT *dmaAlloc(byte flags) {
+	if (flags & DMA_SYNC) dmaWait();
+	if (((_dmaTail + 1) & (DMA_QUEUE_SIZE - 1)) == _dmaHead) return NULL;
+	return &_dmaQueue[_dmaTail];
+}
+
+
+static bool dmaCommit(byte flags) {
+	_dmaQueue[_dmaTail].flags = flags;
+	_dmaTail = (_dmaTail + 1) & (DMA_QUEUE_SIZE - 1);
+	dmaService();
+	if (flags & DMA_SYNC) dmaWait();
+	return true;
+}
+
+
+bool dmaBusy(void) {
+	return _dmaRunning || _dmaHead != _dmaTail;
+}
+
+
+void dma2dCopy(uint32_t dest, uint32_t src, uint16_t width, uint16_t height, uint16_t srcStride, uint16_t destStride) {
+	dmaJobT job;
+
+	job.ctrl       = DMA_CTRL_2D;
+	job.src        = src;
+	job.dest       = dest;
+	job.width      = width;
+	job.height     = height;
+	job.srcStride  = srcStride;
+	job.destStride = destStride;
+	dmaRun(&job);
+}
+
+
+void dma2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride, byte value) {
+	dmaJobT job;
+
+	job.ctrl       = DMA_CTRL_2D | DMA_CTRL_FILL;
+	job.value      = value;
+	job.dest       = start;
+	job.width      = width;
+	job.height     = height;
+	job.destStride = stride;
+	dmaRun(&job);
+}
+
+
+void dmaCopy(uint32_t dest, uint32_t src, uint32_t length) {
+	dmaJobT job;
+
+	job.ctrl  = 0;
+	job.src   = src;
+	job.dest  = dest;
+	job.count = length;
+	dmaRun(&job);
+}
+
+
+void dmaFill(uint32_t start, uint32_t length, byte value) {
+	dmaJobT job;
+
+	job.ctrl  = DMA_CTRL_FILL;
+	job.value = value;
+	job.dest  = start;
+	job.count = length;
+	dmaRun(&job);
+}
+
+
+byte dmaPending(void) {
+	return (_dmaTail - _dmaHead) & (DMA_QUEUE_SIZE - 1);
+}
+
+
+bool dmaQueue2dCopy(uint32_t dest, uint32_t src, uint16_t width, uint16_t height, uint16_t srcStride, uint16_t destStride, byte flags) {
+	dmaJobT *job = dmaAlloc(flags);
+
+	if (!job) return false;
+	job->ctrl       = DMA_CTRL_2D;
+	job->src        = src;
+	job->dest       = dest;
+	job->width      = width;
+	job->height     = height;
+	job->srcStride  = srcStride;
+	job->destStride = destStride;
+	return dmaCommit(flags);
+}
+
+
+bool dmaQueue2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride, byte value, byte flags) {
+	dmaJobT *job = dmaAlloc(flags);
+
+	if (!job) return false;
+	job->ctrl       = DMA_CTRL_2D | DMA_CTRL_FILL;
+	job->value      = value;
+	job->dest       = start;
+	job->width      = width;
+	job->height     = height;
+	job->destStride = stride;
+	return dmaCommit(flags);
+}
+
+
+bool dmaQueueCopy(uint32_t dest, uint32_t src, uint32_t length, byte flags) {
+	dmaJobT *job = dmaAlloc(flags);
+
+	if (!job) return false;
+	job->ctrl  = 0;
+	job->src   = src;
+	job->dest  = dest;
+	job->count = length;
+	return dmaCommit(flags);
+}
+
+
+bool dmaQueueFill(uint32_t start, uint32_t length, byte value, byte flags) {
+	dmaJobT *job = dmaAlloc(flags);
+
+	if (!job) return false;
+	job->ctrl  = DMA_CTRL_FILL;
+	job->value = value;
+	job->dest  = start;
+	job->count = length;
+	return dmaCommit(flags);
+}
+
+
+bool dmaService(void) {
+	dmaJobT *job;
+
+	if (_dmaRunning) {
+		if (PEEK(DMA_STATUS) & DMA_STAT_BUSY) return true;
+		// Retire: disable the engine and acknowledge the completion interrupt.
+		POKE(DMA_CTRL, 0);
+		POKE(INT_PEND_0, INT06_DMA);
+		_dmaRunning = false;
+	}
+
+	if (_dmaHead == _dmaTail) return false;
+
+	job = &_dmaQueue[_dmaHead];
+	// Rows 480 and up are vertical blank.
+	if ((job->flags & DMA_WAIT_VBL) && PEEKW(RAST_ROW_L) < 480) return true;
+
+	_dmaHead = (_dmaHead + 1) & (DMA_QUEUE_SIZE - 1);
+	dmaStart(job);
+
+	return true;
+}
+
+
+void dmaWait(void) {
+	while (dmaService());
 }
 
 
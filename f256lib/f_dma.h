@@ -12,8 +12,37 @@
 #include "f256lib.h"
 
 
+// Pending jobs held by the DMA queue.  Must be a power of two.
+#ifndef DMA_QUEUE_SIZE
+#define DMA_QUEUE_SIZE  8
+#endif
+
+// Job flags
+#define DMA_NOWAIT    0x00  // Start as soon as the engine is free.
+#define DMA_WAIT_VBL  0x01  // Only start during vertical blank.
+#define DMA_SYNC      0x02  // Empty the queue, then run to completion; never refused.
+
+
+// Immediate transfers.  These wait for vertical blank, start the engine
+// and return; use dmaWait() if the result must be complete.
 void dmaFill(uint32_t start, uint32_t length, byte value);
 void dma2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride, byte value);
+void dmaCopy(uint32_t dest, uint32_t src, uint32_t length);
+void dma2dCopy(uint32_t dest, uint32_t src, uint16_t width, uint16_t height, uint16_t srcStride, uint16_t destStride);
+
+// Queued transfers.  Return false if the queue is full.  Jobs run in
+// order as dmaService() is called; nothing blocks unless DMA_SYNC is
+// given, which makes the call a blocking transfer that always succeeds
+// and lands after everything queued before it.
+bool dmaQueueFill(uint32_t start, uint32_t length, byte value, byte flags);
+bool dmaQueue2dFill(uint32_t start, uint16_t width, uint16_t height, uint16_t stride, byte value, byte flags);
+bool dmaQueueCopy(uint32_t dest, uint32_t src, uint32_t length, byte flags);
+bool dmaQueue2dCopy(uint32_t dest, uint32_t src, uint16_t width, uint16_t height, uint16_t srcStride, uint16_t destStride, byte flags);
+
+bool dmaBusy(void);                // Engine running or jobs still queued.
+byte dmaPending(void);             // Jobs not yet started.
+bool dmaService(void);             // Retire/start jobs; true while work remains.
+void dmaWait(void);                // Service the queue until it is empty.
 
 
 #pragma compile("f_dma.c")
@@ -196,10 +196,7 @@ void sortFileList_far(void)
         bool keyIsDir = FAR_PEEK(FPR_BASE + FPR_isDirList + i);
 
         uint32_t keyBase = FPR_BASE + FPR_fileList + (i * MAX_FILENAME_LEN);
-        for (int k = 0; k < MAX_FILENAME_LEN; k++) {
-            keyName[k] = FAR_PEEK(keyBase + k);
-            if (keyName[k] == 0) break;
-        }
+        farMemcpyNear(keyName, keyBase, MAX_FILENAME_LEN);
 
         int j = i - 1;
 
@@ -224,10 +221,7 @@ void sortFileList_far(void)
                 char jName[MAX_FILENAME_LEN];
                 uint32_t jBase = FPR_BASE + FPR_fileList + (j * MAX_FILENAME_LEN);
 
-                for (int k = 0; k < MAX_FILENAME_LEN; k++) {
-                    jName[k] = FAR_PEEK(jBase + k);
-                    if (jName[k] == 0) break;
-                }
+                farMemcpyNear(jName, jBase, MAX_FILENAME_LEN);
 
                 if (strcasecmp_local(jName, keyName) > 0)
                     shouldShift = true;
@@ -240,10 +234,7 @@ void sortFileList_far(void)
             uint32_t srcBase = FPR_BASE + FPR_fileList + (j * MAX_FILENAME_LEN);
             uint32_t dstBase = FPR_BASE + FPR_fileList + ((j + 1) * MAX_FILENAME_LEN);
 
-            for (int k = 0; k < MAX_FILENAME_LEN; k++) {
-                FAR_POKE(dstBase + k, FAR_PEEK(srcBase + k));
-                if (FAR_PEEK(srcBase + k) == 0) break;
-            }
+            farToFar(dstBase, srcBase, MAX_FILENAME_LEN);
 
             FAR_POKE(FPR_BASE + FPR_isDirList + (j + 1), jIsDir);
 
@@ -252,10 +243,7 @@ void sortFileList_far(void)
 
         // Insert key at j+1
         uint32_t dstBase = FPR_BASE + FPR_fileList + ((j + 1) * MAX_FILENAME_LEN);
-        for (int k = 0; k < MAX_FILENAME_LEN; k++) {
-            FAR_POKE(dstBase + k, keyName[k]);
-            if (keyName[k] == 0) break;
-        }
+        farMemcpy(dstBase, keyName, MAX_FILENAME_LEN);
 
         FAR_POKE(FPR_BASE + FPR_isDirList + (j + 1), keyIsDir);
     }
@@ -8,6 +8,7 @@
 
 
 #include "f256lib.h"
+#include <string.h>
 
 
 const colorT c64Palette[16] = {
@@ -30,29 +31,54 @@ const colorT c64Palette[16] = {
 };
 
 
-void graphicsDefineColor(byte clut, byte slot, byte r, byte g, byte b) {
-	byte      mmu = PEEK(MMU_IO_CTRL);
-	byte     *write;
-	uint16_t  gclut;
+static uint16_t _frames      = 0;
+static byte     _framesLast  = 0;     // Kernel frame counter at the last read.
 
-	switch (clut) {
-		case 0:
-			gclut = VKY_GR_CLUT_0;
-			break;
-		case 1:
-			gclut = VKY_GR_CLUT_1;
-			break;
-		case 2:
-			gclut = VKY_GR_CLUT_2;
-			break;
-		default:
-			gclut = VKY_GR_CLUT_3;
-			break;
+
+// The four CLUTs are 1K apart in I/O page 1.
+#define GRAPHICS_CLUT(clut)  ((byte *)VKY_GR_CLUT_0 + ((uint16_t)((clut) & 3) << 10))
+
+
+void graphicsClockInit(graphicsClockT *c, byte maxSteps) {
+	c->last     = graphicsFrameCount();
+	c->maxSteps = maxSteps ? maxSteps : 1;
+	c->late     = 0;
+	c->dropped  = 0;
+}
+
+
+// Fixed timestep: returns how many update steps to run for the frames
+// that passed since the last tick (at least one, waiting if need be), at
+// most maxSteps.  Frames that were stepped but not drawn add to late;
+// frames beyond maxSteps are dropped and counted.
+byte graphicsClockTick(graphicsClockT *c) {
+	uint16_t now = graphicsFrameCount();
+	uint16_t elapsed;
+
+	if (now == c->last) {
+		graphicsWaitFrame();
+		now = graphicsFrameCount();
+	}
+
+	elapsed = now - c->last;
+	c->last = now;
+	if (elapsed > c->maxSteps) {
+		c->dropped += elapsed - c->maxSteps;
+		elapsed     = c->maxSteps;
 	}
+	if (elapsed > 1) c->late += elapsed - 1;
+
+	return (byte)elapsed;
+}
+
+
+void graphicsDefineColor(byte clut, byte slot, byte r, byte g, byte b) {
+	byte  mmu = PEEK(MMU_IO_CTRL);
+	byte *write;
 
 	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_1);
 
-	write = (byte *)gclut + (slot * 4);
+	write = GRAPHICS_CLUT(clut) + (slot * 4);
 	*write++ = b;
 	*write++ = g;
 	*write++ = r;
@@ -62,19 +88,86 @@ void graphicsDefineColor(byte clut, byte slot, byte r, byte g, byte b) {
 }
 
 
+// Frames since start-up.  The kernel counts start-of-frame interrupts in
+// 8 bits, so this must be called at least every 255 frames.  Without the
+// kernel the INT00_VKY_SOF latch is polled instead, which only counts
+// frames if it is called every frame.
+uint16_t graphicsFrameCount(void) {
+#ifndef WITHOUT_KERNEL
+	byte now = kernelGetTimerAbsolute(TIMER_FRAMES);
+
+	_frames     += (byte)(now - _framesLast);
+	_framesLast  = now;
+#else
+	byte mmu = PEEK(MMU_IO_CTRL);
+
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	if (PEEK(INT_PEND_0) & INT00_VKY_SOF) {
+		POKE(INT_PEND_0, INT00_VKY_SOF);
+		_frames++;
+	}
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+#endif
+
+	return _frames;
+}
+
+
+// Copy count BGRA entries from far memory into a CLUT, starting at entry
+// first, with a single I/O page switch.
+void graphicsLoadPalette(byte clut, uint32_t address, byte first, uint16_t count) {
+	byte      mmu    = PEEK(MMU_IO_CTRL);
+	byte      block  = address / EIGHTK;
+	uint16_t  offset = address & 0x1FFF;
+	uint16_t  length = count << 2;
+	uint16_t  chunk;
+	byte     *dest;
+
+	SWAP_IO_SETUP();
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_1);
+	dest = GRAPHICS_CLUT(clut) + ((uint16_t)first << 2);
+
+	while (length) {
+		chunk = EIGHTK - offset;
+		if (chunk > length) chunk = length;
+		POKE_MEMMAP(SWAP_SLOT, block++);
+		memcpy(dest, (byte *)(SWAP_ADDR + offset), chunk);
+		dest   += chunk;
+		length -= chunk;
+		offset  = 0;
+	}
+
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+
+
 void graphicsReset(void) {
-	int16_t  x;
-	byte     y;
+	byte  mmu = PEEK(MMU_IO_CTRL);
+	byte *write;
+	byte  x;
+	byte  y;
 
+	// Grey ramp in every CLUT.
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_1);
+	write = (byte *)VKY_GR_CLUT_0;
 	for (y=0; y<4; y++) {
-		for (x=0; x<256; x++) {
-			graphicsDefineColor(y, x, x, x, x);
-		}
+		x = 0;
+		do {
+			*write++ = x;
+			*write++ = x;
+			*write++ = x;
+			*write++ = 0xff;
+		} while (++x);
 	}
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
 
 	graphicsSetLayerBitmap(0, 0);
 	graphicsSetLayerBitmap(1, 1);
 	graphicsSetLayerBitmap(2, 2);
+
+	graphicsFrameCount();
 }
 
 
@@ -101,7 +194,7 @@ void graphicsSetLayerTile(byte layer, byte which) {
 void graphicsPause(uint16_t frames) {
 	uint16_t i;
 	for (i = 0; i < frames; i++)
-		graphicsWaitVerticalBlank();
+		graphicsWaitFrame();
 }
 
 
@@ -137,8 +230,22 @@ void graphicsSetBorderRGB(byte r, byte g, byte b) {
 }
 
 
+// Waits for the next frame count change rather than one exact raster
+// line, so an interrupt can't make it miss a frame.
+void graphicsWaitFrame(void) {
+	uint16_t now = graphicsFrameCount();
+
+	while (graphicsFrameCount() == now)
+		;
+}
+
+
+// Wait for the start of the next vertical blank.  Watching for the edge
+// into the blank, rather than for line 482 exactly, can't be missed.
 void graphicsWaitVerticalBlank(void) {
-	while (PEEKW(RAST_ROW_L) != 482)
+	while (PEEKW(RAST_ROW_L) >= 480)
+		;
+	while (PEEKW(RAST_ROW_L) < 480)
 		;
 }
 
@@ -12,18 +12,32 @@
 #include "f256lib.h"
 
 
+// Fixed-timestep loop state, see graphicsClockTick().
+typedef struct graphicsClockS {
+	uint16_t last;        // Frame count at the previous tick.
+	byte     maxSteps;
+	uint16_t late;        // Frames stepped but not drawn.
+	uint16_t dropped;     // Frames skipped past maxSteps.
+} graphicsClockT;
+
+
 extern const colorT c64Palette[16];
 
-void graphicsDefineColor(byte clut, byte slot, byte r, byte g, byte b);
-void graphicsPause(uint16_t frames);
-void graphicsReset(void);
-void graphicsSetBackgroundC64Color(byte c);
-void graphicsSetBackgroundRGB(byte r, byte g, byte b);
-void graphicsSetBorderC64Color(byte c);
-void graphicsSetBorderRGB(byte r, byte g, byte b);
-void graphicsSetLayerBitmap(byte layer, byte which);
-void graphicsSetLayerTile(byte layer, byte which);
-void graphicsWaitVerticalBlank(void);
+void     graphicsClockInit(graphicsClockT *c, byte maxSteps);
+byte     graphicsClockTick(graphicsClockT *c);
+void     graphicsDefineColor(byte clut, byte slot, byte r, byte g, byte b);
+uint16_t graphicsFrameCount(void);
+void     graphicsLoadPalette(byte clut, uint32_t address, byte first, uint16_t count);
+void     graphicsPause(uint16_t frames);
+void     graphicsReset(void);
+void     graphicsSetBackgroundC64Color(byte c);
+void     graphicsSetBackgroundRGB(byte r, byte g, byte b);
+void     graphicsSetBorderC64Color(byte c);
+void     graphicsSetBorderRGB(byte r, byte g, byte b);
+void     graphicsSetLayerBitmap(byte layer, byte which);
+void     graphicsSetLayerTile(byte layer, byte which);
+void     graphicsWaitFrame(void);
+void     graphicsWaitVerticalBlank(void);
 
 
 #pragma compile("f_graphics.c")
@@ -10,6 +10,339 @@
 #include "f256lib.h"
 
 
+#define MATH_CORDIC_STEPS 14
+
+
+// First quadrant of sine in 0.16, 256 steps plus the endpoint.  The 1.0
+// entry is stored as 0xffff.
+static const uint16_t _sinTable[257] = {
+	    0,   402,   804,  1206,  1608,  2010,  2412,  2814,
+	 3216,  3617,  4019,  4420,  4821,  5222,  5623,  6023,
+	 6424,  6824,  7224,  7623,  8022,  8421,  8820,  9218,
+	 9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391,
+	12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+	15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+	19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699,
+	22078, 22457, 22834, 23210, 23586, 23961, 24335, 24708,
+	25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+	28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+	30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347,
+	33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+	36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716,
+	39040, 39362, 39683, 40002, 40320, 40636, 40951, 41264,
+	41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+	44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056,
+	46341, 46624, 46906, 47186, 47464, 47741, 48015, 48288,
+	48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+	50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398,
+	52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+	54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+	56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607,
+	57798, 57986, 58172, 58356, 58538, 58718, 58896, 59071,
+	59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+	60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+	61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596,
+	62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+	63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197,
+	64277, 64354, 64429, 64501, 64571, 64639, 64704, 64766,
+	64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+	65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436,
+	65457, 65476, 65492, 65505, 65516, 65525, 65531, 65535,
+	65535
+};
+
+// atan(2^-i) in binary angle units (0x10000 per turn).
+static const uint16_t _atanTable[MATH_CORDIC_STEPS] = {
+	8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1
+};
+
+
+// Divide the little-endian number num[0..len-1] in place by d (d > 0)
+// and return the remainder.  Each step produces one quotient byte: for
+// d < 256 a single DIVU does it, otherwise DIVU gives an underestimate
+// from the top bits and MULU checks it (at most two corrections).
+static uint16_t mathDivideBytes(byte *num, byte len, uint16_t d) {
+	uint32_t t;
+	uint32_t r;
+	uint16_t rem = 0;
+	uint16_t dt  = d;
+	byte     q;
+	byte     k   = 0;
+	byte     i;
+
+	if (d < 256) {
+		for (i = len; i-- > 0; ) {
+			POKEW(DIVU_NUM_L, (rem << 8) | num[i]);
+			POKEW(DIVU_DEN_L, d);
+			num[i] = PEEK(QUOU_LL);
+			rem    = PEEKW(REMU_HL);
+		}
+		return rem;
+	}
+
+	// dt is d shifted down to 8 significant bits.
+	while (dt > 255) {
+		dt >>= 1;
+		k++;
+	}
+	dt++;
+
+	for (i = len; i-- > 0; ) {
+		t = ((uint32_t)rem << 8) | num[i];
+		if (t < d) {
+			num[i] = 0;
+			rem    = (uint16_t)t;
+			continue;
+		}
+
+		POKEW(DIVU_NUM_L, (uint16_t)(t >> k));
+		POKEW(DIVU_DEN_L, dt);
+		q = PEEK(QUOU_LL);
+
+		r = t - mathUnsignedMultiply(q, d);
+		while (r >= d) {
+			r -= d;
+			q++;
+		}
+		num[i] = q;
+		rem    = (uint16_t)r;
+	}
+
+	return rem;
+}
+
+
+// Integer square root of a, producing one result bit per step.  With
+// more than 16 steps the extra bits come from zeros shifted in below a,
+// giving fractional result bits.
+static uint32_t mathSqrtBits(uint32_t a, byte steps) {
+	uint32_t rem  = 0;
+	uint32_t root = 0;
+	uint32_t trial;
+
+	while (steps--) {
+		rem   = (rem << 2) | (a >> 30);
+		a   <<= 2;
+		root <<= 1;
+		trial = (root << 1) | 1;
+		if (rem >= trial) {
+			rem  -= trial;
+			root |= 1;
+		}
+	}
+
+	return root;
+}
+
+
+uint16_t mathAtan2(int32_t y, int32_t x) {
+	uint16_t angle = 0;
+	uint32_t m;
+	int32_t  t;
+	byte     i;
+
+	if (x == 0 && y == 0) return 0;
+
+	// Fold into the right half plane.
+	if (x < 0) {
+		x     = -x;
+		y     = -y;
+		angle = MATH_ANGLE_180;
+	}
+
+	// Scale the larger component into [0x4000, 0x8000) for precision
+	// while leaving headroom for the CORDIC gain.
+	m = y < 0 ? -y : y;
+	if ((uint32_t)x > m) m = x;
+	while (m >= 0x8000) {
+		x >>= 1;
+		y >>= 1;
+		m >>= 1;
+	}
+	while (m < 0x4000) {
+		x <<= 1;
+		y <<= 1;
+		m <<= 1;
+	}
+
+	// Rotate the vector onto the X axis, summing the angles used.
+	for (i = 0; i < MATH_CORDIC_STEPS; i++) {
+		if (y > 0) {
+			t      = x + (y >> i);
+			y     -= x >> i;
+			angle += _atanTable[i];
+		} else if (y < 0) {
+			t      = x - (y >> i);
+			y     += x >> i;
+			angle -= _atanTable[i];
+		} else {
+			break;
+		}
+		x = t;
+	}
+
+	return angle;
+}
+
+
+uint16_t mathDistance(int16_t dx, int16_t dy) {
+	uint16_t ux = dx < 0 ? -dx : dx;
+	uint16_t uy = dy < 0 ? -dy : dy;
+
+	return (uint16_t)mathSqrtBits(mathUnsignedMultiply(ux, ux) + mathUnsignedMultiply(uy, uy), 16);
+}
+
+
+// Alpha max plus beta min with alpha = 0.9604, beta = 0.3978, never
+// less than the larger component.  Within 4% of the true distance.
+uint16_t mathDistanceFast(int16_t dx, int16_t dy) {
+	uint16_t hi = dx < 0 ? -dx : dx;
+	uint16_t lo = dy < 0 ? -dy : dy;
+	uint16_t r;
+
+	if (lo > hi) {
+		r  = hi;
+		hi = lo;
+		lo = r;
+	}
+
+	r = (uint16_t)((mathUnsignedMultiply(hi, 62943) + mathUnsignedMultiply(lo, 26070)) >> 16);
+	return r < hi ? hi : r;
+}
+
+
+fix16T mathFix16Cos(uint16_t angle) {
+	return mathFix16Sin(angle + MATH_ANGLE_90);
+}
+
+
+// The divisor is reduced to 16 significant bits (relative error below
+// 2^-15) so the whole division is a 48/16 byte-wise divide.
+fix16T mathFix16Division(fix16T a, fix16T b) {
+	byte     n[6];
+	uint32_t ua  = a < 0 ? -a : a;
+	uint32_t ub  = b < 0 ? -b : b;
+	uint32_t hi;
+	uint16_t lo;
+	bool     neg = (a < 0) != (b < 0);
+	byte     k   = 0;
+
+	if (ub == 0) return neg ? -0x7fffffffL : 0x7fffffffL;
+
+	while (ub > 0xffff) {
+		ub >>= 1;
+		k++;
+	}
+
+	// Numerator is ua << (16 - k), 48 bits.
+	hi = ua >> k;
+	lo = (uint16_t)(ua << (16 - k));
+	n[0] = lo;
+	n[1] = lo >> 8;
+	n[2] = hi;
+	n[3] = hi >> 8;
+	n[4] = hi >> 16;
+	n[5] = hi >> 24;
+	mathDivideBytes(n, 6, (uint16_t)ub);
+
+	if (n[5] || n[4] || (n[3] & 0x80)) return neg ? -0x7fffffffL : 0x7fffffffL;
+	hi = ((uint32_t)n[3] << 24) | ((uint32_t)n[2] << 16) | ((uint16_t)n[1] << 8) | n[0];
+
+	return neg ? -(fix16T)hi : (fix16T)hi;
+}
+
+
+// Four MULU partial products; the result is truncated toward zero and
+// wraps on overflow.
+fix16T mathFix16Multiply(fix16T a, fix16T b) {
+	uint32_t ua  = a < 0 ? -a : a;
+	uint32_t ub  = b < 0 ? -b : b;
+	uint16_t ah  = ua >> 16;
+	uint16_t al  = ua;
+	uint16_t bh  = ub >> 16;
+	uint16_t bl  = ub;
+	uint32_t r;
+
+	r = mathUnsignedMultiply(al, bl) >> 16;
+	if (ah) r += mathUnsignedMultiply(ah, bl);
+	if (bh) {
+		r += mathUnsignedMultiply(al, bh);
+		if (ah) r += mathUnsignedMultiply(ah, bh) << 16;
+	}
+
+	return (a < 0) != (b < 0) ? -(fix16T)r : (fix16T)r;
+}
+
+
+fix16T mathFix16Sin(uint16_t angle) {
+	byte     quadrant = angle >> 14;
+	uint16_t a        = angle & 0x3fff;
+	uint16_t v;
+	byte     i;
+	byte     f;
+	fix16T   r;
+
+	if (quadrant & 1) a = 0x4000 - a;
+
+	// 256 table steps per quadrant, linear between them.
+	i = a >> 6;
+	f = a & 0x3f;
+	v = _sinTable[i];
+	if (f) v += ((_sinTable[i + 1] - v) * f) >> 6;
+
+	r = v == 0xffff ? FIX16_ONE : v;
+	return quadrant & 2 ? -r : r;
+}
+
+
+fix16T mathFix16Sqrt(fix16T a) {
+	if (a <= 0) return 0;
+	return (fix16T)mathSqrtBits(a, 24);
+}
+
+
+fix8T mathFix8Cos(uint16_t angle) {
+	return mathFix8Sin(angle + MATH_ANGLE_90);
+}
+
+
+fix8T mathFix8Division(fix8T a, fix8T b) {
+	byte     n[3];
+	bool     neg = false;
+	uint16_t r;
+
+	if (a < 0) {
+		neg = true;
+		a   = -a;
+	}
+	if (b < 0) {
+		neg = !neg;
+		b   = -b;
+	}
+	if (b == 0) return neg ? -0x7fff : 0x7fff;
+
+	n[2] = (uint16_t)a >> 8;
+	n[1] = (byte)a;
+	n[0] = 0;
+	mathDivideBytes(n, 3, b);
+
+	if (n[2] || (n[1] & 0x80)) return neg ? -0x7fff : 0x7fff;
+	r = ((uint16_t)n[1] << 8) | n[0];
+
+	return neg ? -(fix8T)r : (fix8T)r;
+}
+
+
+fix8T mathFix8Multiply(fix8T a, fix8T b) {
+	return (fix8T)(mathSignedMultiply(a, b) >> 8);
+}
+
+
+fix8T mathFix8Sin(uint16_t angle) {
+	return (fix8T)((mathFix16Sin(angle) + 128) >> 8);
+}
+
+
 int16_t mathSignedDivision(int16_t a, int16_t b) {
 	byte    signA = 0;
 	byte    signB = 0;
@@ -59,6 +392,16 @@ int16_t mathSignedDivisionRemainder(int16_t a, int16_t b, int16_t *remainder) {
 }
 
 
+int32_t mathSignedDivision32(int32_t a, int16_t b) {
+	uint32_t q   = a < 0 ? -a : a;
+	bool     neg = (a < 0) != (b < 0);
+
+	mathDivideBytes((byte *)&q, 4, b < 0 ? -b : b);
+
+	return neg ? -(int32_t)q : (int32_t)q;
+}
+
+
 int32_t mathSignedMultiply(int16_t a, int16_t b) {
 	byte    signA = 0;
 	byte    signB = 0;
@@ -83,6 +426,18 @@ int32_t mathSignedMultiply(int16_t a, int16_t b) {
 }
 
 
+int32_t mathSignedMultiply32(int32_t a, int32_t b) {
+	int32_t r = mathUnsignedMultiply32(a < 0 ? -a : a, b < 0 ? -b : b);
+
+	return (a < 0) != (b < 0) ? -r : r;
+}
+
+
+uint16_t mathSqrt(uint32_t a) {
+	return (uint16_t)mathSqrtBits(a, 16);
+}
+
+
 uint32_t mathUnsignedAddition(uint32_t a, uint32_t b) {
 	POKED(ADD_A_LL, a);
 	POKED(ADD_B_LL, b);
@@ -105,6 +460,18 @@ uint16_t mathUnsignedDivisionRemainder(uint16_t a, uint16_t b, uint16_t *remaind
 }
 
 
+uint32_t mathUnsignedDivision32(uint32_t a, uint16_t b) {
+	mathDivideBytes((byte *)&a, 4, b);
+	return a;
+}
+
+
+uint32_t mathUnsignedDivisionRemainder32(uint32_t a, uint16_t b, uint16_t *remainder) {
+	*remainder = mathDivideBytes((byte *)&a, 4, b);
+	return a;
+}
+
+
 uint32_t mathUnsignedMultiply(uint16_t a, uint16_t b) {
 	POKEW(MULU_A_L, a);
 	POKEW(MULU_B_L, b);
@@ -112,4 +479,20 @@ uint32_t mathUnsignedMultiply(uint16_t a, uint16_t b) {
 }
 
 
+// Low 32 bits of the product from three MULU partial products; the
+// high-by-high term only affects bits above 32.
+uint32_t mathUnsignedMultiply32(uint32_t a, uint32_t b) {
+	uint16_t ah = a >> 16;
+	uint16_t al = a;
+	uint16_t bh = b >> 16;
+	uint16_t bl = b;
+	uint16_t cross = 0;
+
+	if (ah) cross  = (uint16_t)mathUnsignedMultiply(ah, bl);
+	if (bh) cross += (uint16_t)mathUnsignedMultiply(al, bh);
+
+	return mathUnsignedMultiply(al, bl) + ((uint32_t)cross << 16);
+}
+
+
 #endif
@@ -12,13 +12,53 @@
 #include "f256lib.h"
 
 
+// Signed fixed point: 8.8 and 16.16.
+typedef int16_t fix8T;
+typedef int32_t fix16T;
+
+#define FIX8_ONE         0x0100
+#define FIX16_ONE        0x00010000L
+
+#define FIX8(f)          ((fix8T)((f) * 256.0))
+#define FIX16(f)         ((fix16T)((f) * 65536.0))
+#define fix8FromInt(i)   ((fix8T)((i) << 8))
+#define fix8ToInt(f)     ((int16_t)((f) >> 8))
+#define fix16FromInt(i)  ((fix16T)(i) << 16)
+#define fix16ToInt(f)    ((int16_t)((f) >> 16))
+#define fix8ToFix16(f)   ((fix16T)(f) << 8)
+#define fix16ToFix8(f)   ((fix8T)((f) >> 8))
+
+// Angles are binary: 0x10000 is one full turn.
+#define MATH_ANGLE_90    0x4000
+#define MATH_ANGLE_180   0x8000
+#define MATH_ANGLE_270   0xc000
+
+
+uint16_t mathAtan2(int32_t y, int32_t x);
+uint16_t mathDistance(int16_t dx, int16_t dy);
+uint16_t mathDistanceFast(int16_t dx, int16_t dy);
+fix16T   mathFix16Cos(uint16_t angle);
+fix16T   mathFix16Division(fix16T a, fix16T b);
+fix16T   mathFix16Multiply(fix16T a, fix16T b);
+fix16T   mathFix16Sin(uint16_t angle);
+fix16T   mathFix16Sqrt(fix16T a);
+fix8T    mathFix8Cos(uint16_t angle);
+fix8T    mathFix8Division(fix8T a, fix8T b);
+fix8T    mathFix8Multiply(fix8T a, fix8T b);
+fix8T    mathFix8Sin(uint16_t angle);
 int16_t  mathSignedDivision(int16_t a, int16_t b);
 int16_t  mathSignedDivisionRemainder(int16_t a, int16_t b, int16_t *remainder);
+int32_t  mathSignedDivision32(int32_t a, int16_t b);
 int32_t  mathSignedMultiply(int16_t a, int16_t b);
+int32_t  mathSignedMultiply32(int32_t a, int32_t b);
+uint16_t mathSqrt(uint32_t a);
 uint32_t mathUnsignedAddition(uint32_t a, uint32_t b);
 uint16_t mathUnsignedDivision(uint16_t a, uint16_t b);
 uint16_t mathUnsignedDivisionRemainder(uint16_t a, uint16_t b, uint16_t *remainder);
+uint32_t mathUnsignedDivision32(uint32_t a, uint16_t b);
+uint32_t mathUnsignedDivisionRemainder32(uint32_t a, uint16_t b, uint16_t *remainder);
 uint32_t mathUnsignedMultiply(uint16_t a, uint16_t b);
+uint32_t mathUnsignedMultiply32(uint32_t a, uint32_t b);
 
 
 #pragma compile("f_math.c")
@@ -0,0 +1,228 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef WITHOUT_MESH
+
+
+#include "f256lib.h"
+
+
+// Rotation matrix in 2.14, row major.
+static int16_t _matrix[9] = { 0x4000, 0, 0, 0, 0x4000, 0, 0, 0, 0x4000 };
+static int16_t _posX      = 0;
+static int16_t _posY      = 0;
+static int16_t _posZ      = 256;
+static int16_t _centerX   = 160;
+static int16_t _centerY   = 120;
+static int16_t _focal     = 256;
+
+
+#define meshMul14(a, b) ((int16_t)(mathSignedMultiply((a), (b)) >> 14))
+
+
+// Record the edge a-b for face f, reusing it if the neighbouring face
+// already added it.  Edges are chained per lower vertex index so the
+// search only visits edges that share that vertex.
+static void meshAddEdge(meshT *mesh, uint16_t *first, uint16_t *next, uint16_t a, uint16_t b, uint16_t f) {
+	uint16_t   i;
+	meshEdgeT *e;
+
+	if (a > b) {
+		i = a;
+		a = b;
+		b = i;
+	}
+
+	for (i = first[a]; i != MESH_NONE; i = next[i]) {
+		e = &mesh->edges[i];
+		if (e->b == b) {
+			if (e->face2 == MESH_NONE) e->face2 = f;
+			return;
+		}
+	}
+
+	i        = mesh->edgeCount++;
+	e        = &mesh->edges[i];
+	e->a     = a;
+	e->b     = b;
+	e->face1 = f;
+	e->face2 = MESH_NONE;
+	next[i]  = first[a];
+	first[a] = i;
+}
+
+
+void meshDraw(meshT *mesh, bool cull) {
+	const uint16_t *face = mesh->faces;
+	meshPointT     *p    = mesh->projected;
+	meshPointT     *pa;
+	meshPointT     *pb;
+	meshEdgeT      *e    = mesh->edges;
+	uint16_t        maxX;
+	uint16_t        maxY;
+	uint16_t        i;
+	int32_t         cross;
+
+	bitmapGetResolution(&maxX, &maxY);
+
+	// Facing from the screen-space winding of each face's first corner.
+	if (cull) {
+		for (i = 0; i < mesh->faceCount; i++) {
+			pa = &p[face[1]];
+			pb = &p[face[2]];
+			if (pa->x == MESH_CLIPPED || pb->x == MESH_CLIPPED || p[face[3]].x == MESH_CLIPPED) {
+				mesh->facing[i] = 0;
+			} else {
+				cross = mathSignedMultiply(pb->x - pa->x, p[face[3]].y - pa->y)
+				      - mathSignedMultiply(pb->y - pa->y, p[face[3]].x - pa->x);
+				mesh->facing[i] = cross > 0;
+			}
+			face += face[0] + 1;
+		}
+	}
+
+	// Edges with an end off the bitmap are skipped rather than clipped.
+	for (i = 0; i < mesh->edgeCount; i++, e++) {
+		if (cull && !mesh->facing[e->face1] && (e->face2 == MESH_NONE || !mesh->facing[e->face2])) continue;
+		pa = &p[e->a];
+		pb = &p[e->b];
+		if ((uint16_t)pa->x >= maxX || (uint16_t)pa->y >= maxY) continue;
+		if ((uint16_t)pb->x >= maxX || (uint16_t)pb->y >= maxY) continue;
+		bitmapLine(pa->x, pa->y, pb->x, pb->y);
+	}
+}
+
+
+void meshFree(meshT *mesh) {
+	free(mesh->edges);
+	free(mesh->projected);
+	free(mesh->facing);
+	mesh->edges     = NULL;
+	mesh->projected = NULL;
+	mesh->facing    = NULL;
+	mesh->edgeCount = 0;
+}
+
+
+// Builds the unique edge list once; meshTransform and meshDraw then only
+// touch each vertex and edge once per frame.
+bool meshInit(meshT *mesh, const meshVertexT *vertices, uint16_t vertexCount, const uint16_t *faces, uint16_t faceCount) {
+	const uint16_t *face;
+	uint16_t       *first;
+	uint16_t       *next;
+	uint16_t        sides = 0;
+	uint16_t        i;
+	uint16_t        j;
+	uint16_t        n;
+
+	mesh->vertices    = vertices;
+	mesh->vertexCount = vertexCount;
+	mesh->faces       = faces;
+	mesh->faceCount   = faceCount;
+	mesh->edgeCount   = 0;
+
+	face = faces;
+	for (i = 0; i < faceCount; i++) {
+		sides += face[0];
+		face  += face[0] + 1;
+	}
+
+	mesh->edges     = (meshEdgeT *)malloc(sizeof(meshEdgeT) * sides);
+	mesh->projected = (meshPointT *)malloc(sizeof(meshPointT) * vertexCount);
+	mesh->facing    = (byte *)malloc(faceCount);
+	first           = (uint16_t *)malloc(sizeof(uint16_t) * vertexCount);
+	next            = (uint16_t *)malloc(sizeof(uint16_t) * sides);
+
+	if (!mesh->edges || !mesh->projected || !mesh->facing || !first || !next) {
+		free(first);
+		free(next);
+		meshFree(mesh);
+		return false;
+	}
+
+	for (i = 0; i < vertexCount; i++) first[i] = MESH_NONE;
+
+	face = faces;
+	for (i = 0; i < faceCount; i++) {
+		n = face[0];
+		for (j = 1; j < n; j++) meshAddEdge(mesh, first, next, face[j], face[j + 1], i);
+		meshAddEdge(mesh, first, next, face[n], face[1], i);
+		face += n + 1;
+	}
+
+	free(first);
+	free(next);
+
+	return true;
+}
+
+
+void meshSetPosition(int16_t x, int16_t y, int16_t z) {
+	_posX = x;
+	_posY = y;
+	_posZ = z;
+}
+
+
+void meshSetProjection(int16_t centerX, int16_t centerY, int16_t focal) {
+	_centerX = centerX;
+	_centerY = centerY;
+	_focal   = focal;
+}
+
+
+// Rotation about X, then Y, then Z, angles in binary units.
+void meshSetRotation(uint16_t ax, uint16_t ay, uint16_t az) {
+	int16_t sx = (int16_t)(mathFix16Sin(ax) >> 2);
+	int16_t cx = (int16_t)(mathFix16Cos(ax) >> 2);
+	int16_t sy = (int16_t)(mathFix16Sin(ay) >> 2);
+	int16_t cy = (int16_t)(mathFix16Cos(ay) >> 2);
+	int16_t sz = (int16_t)(mathFix16Sin(az) >> 2);
+	int16_t cz = (int16_t)(mathFix16Cos(az) >> 2);
+	int16_t sxsy = meshMul14(sx, sy);
+	int16_t cxsy = meshMul14(cx, sy);
+
+	_matrix[0] = meshMul14(cy, cz);
+	_matrix[1] = meshMul14(sxsy, cz) - meshMul14(cx, sz);
+	_matrix[2] = meshMul14(cxsy, cz) + meshMul14(sx, sz);
+	_matrix[3] = meshMul14(cy, sz);
+	_matrix[4] = meshMul14(sxsy, sz) + meshMul14(cx, cz);
+	_matrix[5] = meshMul14(cxsy, sz) - meshMul14(sx, cz);
+	_matrix[6] = -sy;
+	_matrix[7] = meshMul14(sx, cy);
+	_matrix[8] = meshMul14(cx, cy);
+}
+
+
+// Rotate, translate and project every vertex into the projected cache.
+// Nine MULU products per vertex, and the perspective divides use the
+// DIVU-based 32/16 division.
+void meshTransform(meshT *mesh) {
+	const meshVertexT *v = mesh->vertices;
+	meshPointT        *p = mesh->projected;
+	uint16_t           i;
+	int16_t            x;
+	int16_t            y;
+	int16_t            z;
+
+	for (i = 0; i < mesh->vertexCount; i++, v++, p++) {
+		x = (int16_t)((mathSignedMultiply(_matrix[0], v->x) + mathSignedMultiply(_matrix[1], v->y) + mathSignedMultiply(_matrix[2], v->z)) >> 14) + _posX;
+		y = (int16_t)((mathSignedMultiply(_matrix[3], v->x) + mathSignedMultiply(_matrix[4], v->y) + mathSignedMultiply(_matrix[5], v->z)) >> 14) + _posY;
+		z = (int16_t)((mathSignedMultiply(_matrix[6], v->x) + mathSignedMultiply(_matrix[7], v->y) + mathSignedMultiply(_matrix[8], v->z)) >> 14) + _posZ;
+
+		if (z < MESH_NEAR) {
+			p->x = MESH_CLIPPED;
+			p->y = MESH_CLIPPED;
+			continue;
+		}
+
+		p->x = _centerX + (int16_t)mathSignedDivision32(mathSignedMultiply(x, _focal), z);
+		p->y = _centerY + (int16_t)mathSignedDivision32(mathSignedMultiply(y, _focal), z);
+	}
+}
+
+
+#endif
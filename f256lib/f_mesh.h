@@ -0,0 +1,66 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef MESH_H
+#define MESH_H
+#ifndef WITHOUT_MESH
+
+
+#include "f256lib.h"
+
+
+#define MESH_NONE     0xffff   // No face on this side of an edge.
+#define MESH_CLIPPED  -32768   // Projected X of a vertex behind the near plane.
+#define MESH_NEAR     8        // Smallest view Z that is projected.
+
+
+// Model space: X right, Y down, Z away from the viewer.
+typedef struct meshVertexS {
+	int16_t x;
+	int16_t y;
+	int16_t z;
+} meshVertexT;
+
+typedef struct meshPointS {
+	int16_t x;
+	int16_t y;
+} meshPointT;
+
+typedef struct meshEdgeS {
+	uint16_t a;
+	uint16_t b;
+	uint16_t face1;
+	uint16_t face2;   // MESH_NONE on open meshes.
+} meshEdgeT;
+
+// Faces are packed as a vertex count followed by that many indices,
+// wound clockwise as seen from outside the mesh.
+typedef struct meshS {
+	const meshVertexT *vertices;
+	uint16_t           vertexCount;
+	const uint16_t    *faces;
+	uint16_t           faceCount;
+	meshEdgeT         *edges;       // Unique edges, built by meshInit.
+	uint16_t           edgeCount;
+	meshPointT        *projected;   // Screen positions from meshTransform.
+	byte              *facing;      // Non-zero for faces toward the viewer.
+} meshT;
+
+
+bool meshInit(meshT *mesh, const meshVertexT *vertices, uint16_t vertexCount, const uint16_t *faces, uint16_t faceCount);
+void meshFree(meshT *mesh);
+void meshSetRotation(uint16_t ax, uint16_t ay, uint16_t az);
+void meshSetPosition(int16_t x, int16_t y, int16_t z);
+void meshSetProjection(int16_t centerX, int16_t centerY, int16_t focal);
+void meshTransform(meshT *mesh);
+void meshDraw(meshT *mesh, bool cull);
+
+
+#pragma compile("f_mesh.c")
+
+
+#endif
+#endif // MESH_H
@@ -91,7 +91,6 @@ uint8_t midiplayLoadFile(const char *name, uint32_t targetAddress) {
 	uint8_t buffer[255];
 	size_t bytesRead = 0;
 	uint32_t totalBytesRead = 0;
-	uint16_t i = 0;
 
 	theMIDIfile = fileOpen(name, "r");
 	if (theMIDIfile == NULL) {
@@ -99,10 +98,7 @@ uint8_t midiplayLoadFile(const char *name, uint32_t targetAddress) {
 	}
 
 	while ((bytesRead = fileRead(buffer, sizeof(uint8_t), 250, theMIDIfile)) > 0) {
-		buffer[0] = buffer[0];
-		for (i = 0; i < bytesRead; i++) {
-			FAR_POKE((uint32_t)targetAddress + (uint32_t)totalBytesRead + (uint32_t)i, buffer[i]);
-		}
+		farMemcpy(targetAddress + totalBytesRead, buffer, bytesRead);
 		totalBytesRead += (uint32_t)bytesRead;
 		if (bytesRead < 250) break;
 	}
@@ -120,9 +116,8 @@ int16_t midiplayFindHeader(uint32_t baseAddr) {
 	char *position;
 	int thePosition = 0;
 	char buffer[64];
-	int i = 0;
 
-	for (i = 0; i < 64; i++) buffer[i] = FAR_PEEK(baseAddr + i);
+	farMemcpyNear(buffer, baseAddr, 64);
 
 	position = strstr(buffer, targetSequence);
 
@@ -351,7 +346,7 @@ int8_t midiplayParse(uint16_t startIndex, bool wantCmds, midiplayRecordT *rec, m
 					          | (((uint32_t)data_byte3) << 8)
 					          | ((uint32_t)data_byte4);
 
-					usPerTick = (uint32_t)usPerBeat / ((uint32_t)rec->tick);
+					usPerTick = mathUnsignedDivision32(usPerBeat, (uint16_t)rec->tick);
 					timer0PerTick = (uint32_t)((float)usPerTick * (float)rec->fudge);
 					rec->bpm = (uint16_t)((uint32_t)60000000UL / ((uint32_t)usPerBeat));
 				} else if (meta_byte == MIDI_META_SMPTE_OFFSET) {
@@ -375,9 +370,9 @@ int8_t midiplayParse(uint16_t startIndex, bool wantCmds, midiplayRecordT *rec, m
 				}
 				if (wantCmds) {
 					whereTo = (uint32_t)(list->TrackEventList[currentTrack].baseOffset);
-					whereTo += (uint32_t)((uint32_t)interestingIndex * (uint32_t)MIDI_EVENT_FAR_SIZE);
+					whereTo += mathUnsignedMultiply(interestingIndex, MIDI_EVENT_FAR_SIZE);
 
-					tempCalc = timer0PerTick * timeDelta;
+					tempCalc = mathUnsignedMultiply32(timer0PerTick, timeDelta);
 					superTotal += (uint32_t)(tempCalc) >> 3;
 
 					FAR_POKE((uint32_t)rec->parsedAddr + (uint32_t)whereTo,                (uint8_t)((tempCalc & 0x000000FF)));
@@ -406,9 +401,9 @@ int8_t midiplayParse(uint16_t startIndex, bool wantCmds, midiplayRecordT *rec, m
 						lastCmdPreserver = true;
 					}
 					whereTo = (uint32_t)(list->TrackEventList[currentTrack].baseOffset);
-					whereTo += (uint32_t)((uint32_t)interestingIndex * (uint32_t)MIDI_EVENT_FAR_SIZE);
+					whereTo += mathUnsignedMultiply(interestingIndex, MIDI_EVENT_FAR_SIZE);
 
-					tempCalc = timer0PerTick * timeDelta;
+					tempCalc = mathUnsignedMultiply32(timer0PerTick, timeDelta);
 					superTotal += (uint32_t)(tempCalc) >> 3;
 
 					FAR_POKE((uint32_t)rec->parsedAddr + (uint32_t)whereTo,                (uint8_t)((tempCalc & 0x000000FF)));
@@ -627,14 +622,14 @@ uint8_t midiplayPlayV1(midiplayRecordT *rec, midiplayParsedListT *list) {
 				lowestTimeFound = 0;
 				lowestTrack = i;
 				whereToLowest = (uint32_t)(list->TrackEventList[i].baseOffset);
-				whereToLowest += (uint32_t)((uint32_t)rec->parsers[i] * (uint32_t)MIDI_EVENT_FAR_SIZE);
+				whereToLowest += mathUnsignedMultiply(rec->parsers[i], MIDI_EVENT_FAR_SIZE);
 				break;
 			}
 			if (delta < lowestTimeFound) {
 				lowestTimeFound = delta;
 				lowestTrack = i;
 				whereToLowest = (uint32_t)(list->TrackEventList[i].baseOffset);
-				whereToLowest += (uint32_t)((uint32_t)rec->parsers[i] * (uint32_t)MIDI_EVENT_FAR_SIZE);
+				whereToLowest += mathUnsignedMultiply(rec->parsers[i], MIDI_EVENT_FAR_SIZE);
 			}
 		}
 
@@ -664,7 +659,7 @@ uint8_t midiplayPlayV1(midiplayRecordT *rec, midiplayParsedListT *list) {
 
 		rec->parsers[lowestTrack] += 1;
 		whereToLowest = (uint32_t)(list->TrackEventList[lowestTrack].baseOffset);
-		whereToLowest += (uint32_t)((uint32_t)rec->parsers[lowestTrack] * (uint32_t)MIDI_EVENT_FAR_SIZE);
+		whereToLowest += mathUnsignedMultiply(rec->parsers[lowestTrack], MIDI_EVENT_FAR_SIZE);
 
 		soundBeholders[lowestTrack] = (
 			(((uint32_t)(FAR_PEEK((uint32_t)rec->parsedAddr + (uint32_t)whereToLowest))) & 0x000000FF)
@@ -700,7 +695,7 @@ uint8_t midiplayPlayType0(midiplayRecordT *rec, midiplayParsedListT *list) {
 
 	while (localTotalLeft > 0 && !exitFlag) {
 		whereTo = (uint32_t)(list->TrackEventList[0].baseOffset);
-		whereTo += (uint32_t)((uint32_t)rec->parsers[0] * (uint32_t)MIDI_EVENT_FAR_SIZE);
+		whereTo += mathUnsignedMultiply(rec->parsers[0], MIDI_EVENT_FAR_SIZE);
 
 		msgGo.deltaToGo = (
 			(((uint32_t)(FAR_PEEK((uint32_t)rec->parsedAddr + (uint32_t)whereTo))) & 0x000000FF)
@@ -1154,7 +1149,7 @@ void midiplaySniffNext(void) {
 	}
 
 	if (midiplayTheOne.cuedDelta > 0) {
-		midiplayTheOne.cuedDelta = midiplayTheOne.cuedDelta * midiplayTheOne.timer0PerTick;
+		midiplayTheOne.cuedDelta = mathUnsignedMultiply32(midiplayTheOne.cuedDelta, midiplayTheOne.timer0PerTick);
 	}
 	timer0Set(midiplayTheOne.cuedDelta);
 }
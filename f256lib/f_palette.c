@@ -0,0 +1,266 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef WITHOUT_PALETTE
+
+
+#include "f256lib.h"
+#include <string.h>
+
+
+// Effects work on a near copy of one CLUT.  paletteService() advances
+// them and writes the entries that changed during vertical blank, at most
+// PALETTE_BUDGET entries of each per call, so its cost per frame is
+// bounded however large the effect.
+
+typedef struct paletteCycleS {
+	byte first;
+	byte count;          // 0 when the slot is free.
+	byte delay;          // Frames per step.
+	byte timer;
+} paletteCycleT;
+
+
+static byte          _palette[256 * 4];          // BGRA, as in the CLUT.
+static byte          _clut       = 0;
+static uint16_t      _dirtyFirst = 0;            // Entries waiting to be written.
+static uint16_t      _dirtyEnd   = 0;
+static paletteCycleT _cycle[PALETTE_CYCLES];
+
+// Fade ramps: each channel steps from its start color by a fixed 8.8
+// delta, worked out once when the fade starts.
+static uint16_t      _fadeValue[256 * 3];
+static int16_t       _fadeDelta[256 * 3];
+static uint32_t      _fadeTo;
+static byte          _fadeFirst;
+static uint16_t      _fadeCount;
+static uint16_t      _fadeSteps  = 0;            // Steps left; 0 when idle.
+static uint16_t      _fadeNext;                  // Next entry of the current step.
+
+
+static void paletteDirty(uint16_t first, uint16_t end) {
+	if (_dirtyFirst == _dirtyEnd) {
+		_dirtyFirst = first;
+		_dirtyEnd   = end;
+		return;
+	}
+	if (first < _dirtyFirst) _dirtyFirst = first;
+	if (end > _dirtyEnd) _dirtyEnd = end;
+}
+
+
+// Copy a palette (or black) into the near copy.
+static void paletteFetch(uint32_t address, byte first, uint16_t count) {
+	byte *p = &_palette[(uint16_t)first << 2];
+
+	if (address == PALETTE_BLACK) {
+		while (count--) {
+			p[0] = p[1] = p[2] = 0;
+			p[3] = 0xff;
+			p   += 4;
+		}
+		return;
+	}
+	farMemcpyNear(p, address, count << 2);
+}
+
+
+// Move each entry of a cycling range up one place; the last wraps round.
+static void paletteRotate(paletteCycleT *c) {
+	byte     *p = &_palette[(uint16_t)c->first << 2];
+	uint16_t  n = (uint16_t)(c->count - 1) << 2;
+	byte      last[4];
+
+	memcpy(last, p + n, 4);
+	memmove(p + 4, p, n);
+	memcpy(p, last, 4);
+	paletteDirty(c->first, c->first + c->count);
+}
+
+
+// Rotate entries first .. first + count - 1 by one every delay frames.
+// Returns the cycle slot, or 0xff if all PALETTE_CYCLES are in use.
+byte paletteCycle(byte first, byte count, byte delay) {
+	paletteCycleT *c;
+	byte           i;
+
+	if (count < 2) return 0xff;
+	for (i = 0; i < PALETTE_CYCLES; i++) {
+		c = &_cycle[i];
+		if (c->count) continue;
+		c->first = first;
+		c->count = count;
+		c->delay = delay ? delay : 1;
+		c->timer = c->delay;
+		return i;
+	}
+
+	return 0xff;
+}
+
+
+void paletteCycleStop(byte cycle) {
+	_cycle[cycle].count = 0;
+}
+
+
+// Cross-fade entries first .. first + count - 1 from their current colors
+// to the palette at far address to (or PALETTE_BLACK) over frames calls
+// of paletteService().  A step touches PALETTE_BUDGET entries per call,
+// so large ranges take fewer, longer steps.
+void paletteFade(uint32_t to, byte first, uint16_t count, uint16_t frames) {
+	byte     target[4 * 64];
+	byte    *from;
+	uint16_t steps;
+	uint16_t done;
+	uint16_t chunk;
+	uint16_t i;
+	uint16_t k;
+	byte     c;
+
+	if (frames < 2 || !count) {
+		_fadeSteps = 0;
+		paletteFetch(to, first, count);
+		paletteDirty(first, first + count);
+		return;
+	}
+
+	steps = frames / ((count + PALETTE_BUDGET - 1) / PALETTE_BUDGET);
+	if (!steps) steps = 1;
+
+	// Targets are read 64 entries at a time to keep the stack small.  A
+	// single step has no ramp; it just lands on the target.
+	for (done = 0; steps > 1 && done < count; done += chunk) {
+		chunk = count - done;
+		if (chunk > 64) chunk = 64;
+		if (to == PALETTE_BLACK) {
+			memset(target, 0, chunk << 2);
+		} else {
+			farMemcpyNear(target, to + (done << 2), chunk << 2);
+		}
+		for (i = 0; i < chunk; i++) {
+			from = &_palette[(first + done + i) << 2];
+			k    = (done + i) * 3;
+			for (c = 0; c < 3; c++) {
+				_fadeValue[k + c] = ((uint16_t)from[c] << 8) | 0x80;
+				_fadeDelta[k + c] = (int16_t)mathSignedDivision32((int32_t)((int16_t)target[(i << 2) + c] - from[c]) << 8, steps);
+			}
+		}
+	}
+
+	_fadeTo    = to;
+	_fadeFirst = first;
+	_fadeCount = count;
+	_fadeSteps = steps;
+	_fadeNext  = 0;
+}
+
+
+bool paletteFading(void) {
+	return _fadeSteps != 0;
+}
+
+
+// Take over a CLUT, starting from what it holds now.
+void paletteInit(byte clut) {
+	byte mmu = PEEK(MMU_IO_CTRL);
+	byte i;
+
+	_clut       = clut & 3;
+	_fadeSteps  = 0;
+	_dirtyFirst = 0;
+	_dirtyEnd   = 0;
+	for (i = 0; i < PALETTE_CYCLES; i++) _cycle[i].count = 0;
+
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_1);
+	memcpy(_palette, (byte *)VKY_GR_CLUT_0 + ((uint16_t)_clut << 10), sizeof(_palette));
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+}
+
+
+// Load BGRA entries from far memory; they are shown at the next service.
+void paletteLoad(uint32_t address, byte first, uint16_t count) {
+	paletteFetch(address, first, count);
+	paletteDirty(first, first + count);
+}
+
+
+// Call once per frame.  Steps cycles and the fade, then writes changed
+// entries once vertical blank starts.  True while work remains.
+bool paletteService(void) {
+	paletteCycleT *c;
+	uint16_t       k;
+	uint16_t       v;
+	byte          *p;
+	byte           mmu;
+	byte           i;
+	byte           n;
+
+	for (i = 0; i < PALETTE_CYCLES; i++) {
+		c = &_cycle[i];
+		if (!c->count || --c->timer) continue;
+		c->timer = c->delay;
+		paletteRotate(c);
+	}
+
+	if (_fadeSteps) {
+		k = _fadeCount - _fadeNext;
+		if (k > PALETTE_BUDGET) k = PALETTE_BUDGET;
+		paletteDirty(_fadeFirst + _fadeNext, _fadeFirst + _fadeNext + k);
+
+		if (_fadeSteps == 1) {
+			// Last step lands exactly on the target.
+			paletteFetch(_fadeTo == PALETTE_BLACK ? PALETTE_BLACK : _fadeTo + ((uint32_t)_fadeNext << 2), _fadeFirst + _fadeNext, k);
+			_fadeNext += k;
+		} else {
+			p         = &_palette[(_fadeFirst + _fadeNext) << 2];
+			v         = _fadeNext * 3;
+			_fadeNext += k;
+			while (k--) {
+				for (n = 0; n < 3; n++, v++) {
+					_fadeValue[v] += _fadeDelta[v];
+					p[n] = _fadeValue[v] >> 8;
+				}
+				p += 4;
+			}
+		}
+		if (_fadeNext == _fadeCount) {
+			_fadeNext = 0;
+			_fadeSteps--;
+		}
+	}
+
+	if (_dirtyFirst != _dirtyEnd) {
+		k = _dirtyEnd - _dirtyFirst;
+		if (k > PALETTE_BUDGET) k = PALETTE_BUDGET;
+
+		mmu = PEEK(MMU_IO_CTRL);
+		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+		while (PEEKW(RAST_ROW_L) < 480)
+			;
+		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_1);
+		memcpy((byte *)VKY_GR_CLUT_0 + ((uint16_t)_clut << 10) + (_dirtyFirst << 2), &_palette[_dirtyFirst << 2], k << 2);
+		POKE_MEMMAP(MMU_IO_CTRL, mmu);
+
+		_dirtyFirst += k;
+	}
+
+	return _fadeSteps || _dirtyFirst != _dirtyEnd;
+}
+
+
+void paletteSet(byte slot, byte r, byte g, byte b) {
+	byte *p = &_palette[(uint16_t)slot << 2];
+
+	p[0] = b;
+	p[1] = g;
+	p[2] = r;
+	p[3] = 0xff;
+	paletteDirty(slot, slot + 1);
+}
+
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef PALETTE_H
+#define PALETTE_H
+#ifndef WITHOUT_PALETTE
+
+
+#include "f256lib.h"
+
+
+#ifndef PALETTE_BUDGET
+#define PALETTE_BUDGET  64    // Entries faded and written per paletteService().
+#endif
+#ifndef PALETTE_CYCLES
+#define PALETTE_CYCLES  4     // Color cycling ranges.
+#endif
+
+#define PALETTE_BLACK   0xffffffffUL   // Fade target meaning all black.
+
+
+void paletteInit(byte clut);
+void paletteLoad(uint32_t address, byte first, uint16_t count);
+void paletteSet(byte slot, byte r, byte g, byte b);
+void paletteFade(uint32_t to, byte first, uint16_t count, uint16_t frames);
+bool paletteFading(void);
+byte paletteCycle(byte first, byte count, byte delay);
+void paletteCycleStop(byte cycle);
+bool paletteService(void);
+
+
+#pragma compile("f_palette.c")
+
+
+#endif
+#endif // PALETTE_H
@@ -11,9 +11,7 @@
 
 
 void f256putchar(char c) {
-	static char s[2] = { 0, 0 };
-	s[0] = c;
-	textPrint(s);
+	textPutChar(c);
 }
 
 
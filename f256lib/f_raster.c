@@ -0,0 +1,293 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef WITHOUT_RASTER
+
+
+#include "f256lib.h"
+
+
+// One line compare register serves every client.  Only the earliest line
+// any client wants is armed; when it fires, every client whose line has
+// been reached runs and the next earliest is armed.  With nothing left
+// in the frame the start of vertical blank is armed, where each client
+// runs its vblank() and hands over its first line of the next frame.
+
+static const rasterClientT *_client[RASTER_CLIENTS];
+static int16_t              _clientLine[RASTER_CLIENTS];
+static byte                 _clients = 0;
+static uint16_t             _chain   = 0;     // IRQ vector we replaced, 0 if none.
+
+// rasterSchedule() runs its list as a client of its own.
+static const rasterEntryT *_entries = NULL;
+static byte                _count   = 0;
+static byte                _next    = 0;
+
+static int16_t rasterScheduleFirst(void);
+static int16_t rasterScheduleRun(void);
+
+static const rasterClientT _schedule = { NULL, rasterScheduleFirst, rasterScheduleRun };
+
+
+static bool rasterDispatch(void);
+
+
+// Called from rasterIrqEntry.  __interrupt saves the compiler's zero page
+// registers so the interrupted code doesn't see them change.
+static __interrupt void rasterIrq(void) {
+	rasterDispatch();
+}
+
+
+// Installed at VIRQ: service the line interrupt, then carry on into the
+// previous handler (normally the kernel's) with the registers intact.
+__asm rasterIrqEntry {
+		pha
+		txa
+		pha
+		tya
+		pha
+		jsr rasterIrq
+		pla
+		tay
+		pla
+		tax
+		pla
+		jmp (_chain)
+}
+
+
+// Arm the earliest line any client wants, or the start of vertical blank.
+// Caller has mapped I/O page 0.
+static int16_t rasterArm(void) {
+	int16_t line = RASTER_NO_LINE;
+	byte    i;
+
+	if (!_clients) {
+		POKE(VKY_LINE_CTRL, 0);
+		return RASTER_NO_LINE;
+	}
+
+	for (i = 0; i < RASTER_CLIENTS; i++) {
+		if (_client[i] && _clientLine[i] < line) line = _clientLine[i];
+	}
+	if (line == RASTER_NO_LINE) line = RASTER_VBLANK_LINE;
+	if (line < 0) line = 0;
+
+	POKE(VKY_LINE_NBR_L, LOW_BYTE(line));
+	POKE(VKY_LINE_NBR_H, HIGH_BYTE(line));
+	POKE(VKY_LINE_CTRL, VKY_LINE_ENABLE);
+
+	return line;
+}
+
+
+// Run one client until it wants a line the beam hasn't reached.
+static void rasterCatchUp(byte i, int16_t row) {
+	const rasterClientT *c = _client[i];
+
+	while (_clientLine[i] <= row) {
+		_clientLine[i] = c->run ? c->run() : RASTER_NO_LINE;
+	}
+}
+
+
+static bool rasterDispatch(void) {
+	const rasterClientT *c;
+	byte                 mmu;
+	byte                 i;
+	int16_t              row;
+	int16_t              line;
+
+	mmu = PEEK(MMU_IO_CTRL);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	if (!(PEEK(INT_PEND_0) & INT01_VKY_SOL)) {
+		POKE_MEMMAP(MMU_IO_CTRL, mmu);
+		return false;
+	}
+	POKE(INT_PEND_0, INT01_VKY_SOL);
+	if (!_clients) {
+		POKE(VKY_LINE_CTRL, 0);
+		POKE_MEMMAP(MMU_IO_CTRL, mmu);
+		return false;
+	}
+
+	// Loop in case the beam passes the newly armed line while we work.
+	for (;;) {
+		row = PEEKW(RAST_ROW_L);
+
+		if (row >= RASTER_VBLANK_LINE) {
+			for (i = 0; i < RASTER_CLIENTS; i++) {
+				if (_client[i]) rasterCatchUp(i, RASTER_NO_LINE - 1);
+			}
+			for (i = 0; i < RASTER_CLIENTS; i++) {
+				c = _client[i];
+				if (c && c->vblank) c->vblank();
+			}
+			for (i = 0; i < RASTER_CLIENTS; i++) {
+				c = _client[i];
+				if (c) _clientLine[i] = c->first ? c->first() : RASTER_NO_LINE;
+			}
+			// Every line is in the next frame now, so this can't be late.
+			rasterArm();
+			break;
+		}
+
+		for (i = 0; i < RASTER_CLIENTS; i++) {
+			if (_client[i]) rasterCatchUp(i, row);
+		}
+		line = rasterArm();
+		if ((int16_t)PEEKW(RAST_ROW_L) < line) break;
+	}
+
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+
+	return true;
+}
+
+
+// Share the line interrupt.  The client starts at the next vertical
+// blank.  False if RASTER_CLIENTS are already in use.
+bool rasterAddClient(const rasterClientT *client) {
+	byte mmu;
+	byte i;
+
+	for (i = 0; i < RASTER_CLIENTS; i++) {
+		if (_client[i] == client) return true;
+	}
+	for (i = 0; i < RASTER_CLIENTS; i++) {
+		if (!_client[i]) break;
+	}
+	if (i == RASTER_CLIENTS) return false;
+
+	mmu = PEEK(MMU_IO_CTRL);
+	__asm volatile { sei }
+	_client[i]     = client;
+	_clientLine[i] = RASTER_NO_LINE;
+	if (!_clients++) {
+		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+		POKE(INT_PEND_0, INT01_VKY_SOL);
+		rasterArm();
+		POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	}
+	__asm volatile { cli }
+
+	return true;
+}
+
+
+// Hook the line interrupt: rasterService() then runs from the IRQ and no
+// longer needs polling.  The previous handler still runs after it.
+void rasterInstall(void) {
+	byte mmu = PEEK(MMU_IO_CTRL);
+
+	if (_chain) return;
+
+	__asm volatile { sei }
+	_chain = PEEKW(VIRQ);
+	POKEW(VIRQ, (uint16_t)rasterIrqEntry);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	POKE(INT_PEND_0, INT01_VKY_SOL);
+	POKE(INT_MASK_0, PEEK(INT_MASK_0) & ~INT01_VKY_SOL);
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	__asm volatile { cli }
+}
+
+
+// True once rasterInstall() has hooked the line interrupt.
+bool rasterInstalled(void) {
+	return _chain != 0;
+}
+
+
+void rasterRemove(void) {
+	byte mmu = PEEK(MMU_IO_CTRL);
+
+	if (!_chain) return;
+
+	__asm volatile { sei }
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	POKE(INT_MASK_0, PEEK(INT_MASK_0) | INT01_VKY_SOL);
+	POKE(INT_PEND_0, INT01_VKY_SOL);
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	POKEW(VIRQ, _chain);
+	_chain = 0;
+	__asm volatile { cli }
+}
+
+
+void rasterRemoveClient(const rasterClientT *client) {
+	byte mmu;
+	byte i;
+
+	for (i = 0; i < RASTER_CLIENTS; i++) {
+		if (_client[i] == client) break;
+	}
+	if (i == RASTER_CLIENTS) return;
+
+	mmu = PEEK(MMU_IO_CTRL);
+	__asm volatile { sei }
+	_client[i] = NULL;
+	_clients--;
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	rasterArm();
+	if (!_clients) POKE(INT_PEND_0, INT01_VKY_SOL);
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	__asm volatile { cli }
+}
+
+
+// Start running a list of entries sorted by line, from the next frame on.
+// The list is used in place and must stay valid until rasterStop().
+void rasterSchedule(const rasterEntryT *entries, byte count) {
+	rasterRemoveClient(&_schedule);
+
+	_entries = entries;
+	_count   = count;
+	_next    = 0;
+
+	if (count) rasterAddClient(&_schedule);
+}
+
+
+static int16_t rasterScheduleFirst(void) {
+	_next = 0;
+	return _entries[0].line;
+}
+
+
+static int16_t rasterScheduleRun(void) {
+	const rasterEntryT *e = &_entries[_next];
+	const rasterWriteT *w = e->writes;
+	byte                i;
+
+	POKE_MEMMAP(MMU_IO_CTRL, e->page);
+	for (i = 0; i < e->count; i++, w++) POKE(w->address, w->value);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+
+	if (e->callback) e->callback();
+
+	return ++_next < _count ? _entries[_next].line : RASTER_NO_LINE;
+}
+
+
+// Runs from the IRQ after rasterInstall(), and then does nothing when
+// called directly.  Otherwise poll it, or call it from your own handler
+// with INT01_VKY_SOL unmasked.  Runs every client line the beam has
+// reached and arms the next.  True if the line interrupt was pending.
+bool rasterService(void) {
+	if (_chain) return false;
+	return rasterDispatch();
+}
+
+
+void rasterStop(void) {
+	rasterRemoveClient(&_schedule);
+	_count = 0;
+}
+
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ *	Copyright (c) 2024 Scott Duensing, scott@kangaroopunch.com
+ *	Adapted for oscar64.
+ */
+
+
+#ifndef RASTER_H
+#define RASTER_H
+#ifndef WITHOUT_RASTER
+
+
+#include "f256lib.h"
+
+
+#define RASTER_VBLANK_LINE  480      // First line of vertical blank.
+#define RASTER_NO_LINE      0x7fff   // Client has nothing more this frame.
+#ifndef RASTER_CLIENTS
+#define RASTER_CLIENTS      4
+#endif
+
+
+typedef void (*rasterCallbackT)(void);
+
+typedef struct rasterWriteS {
+	uint16_t address;
+	byte     value;
+} rasterWriteT;
+
+// One scheduled change: register writes (in the given I/O page) and then
+// an optional callback, made when the beam reaches line.
+typedef struct rasterEntryS {
+	uint16_t            line;
+	byte                page;       // MMU_IO_PAGE_0, MMU_IO_PAGE_1, ...
+	const rasterWriteT *writes;
+	byte                count;
+	rasterCallbackT     callback;   // NULL for none.
+} rasterEntryT;
+
+// Something sharing the line interrupt.  At the start of vertical blank
+// vblank() runs, then first() gives the first line wanted next frame.
+// run() is called when the beam reaches it and gives the next line.  Lines
+// are RASTER_NO_LINE for none; any function may be NULL.
+typedef struct rasterClientS {
+	void    (*vblank)(void);
+	int16_t (*first)(void);
+	int16_t (*run)(void);
+} rasterClientT;
+
+
+// Everything here runs from rasterService(), which the line interrupt
+// calls after rasterInstall(); without it, poll rasterService().
+// rasterInstall() chains onto the IRQ vector at VIRQ, which must be RAM
+// (it is under the kernel).  Entries at RASTER_VBLANK_LINE and up run at
+// the start of vertical blank.
+bool rasterAddClient(const rasterClientT *client);
+void rasterInstall(void);
+bool rasterInstalled(void);
+void rasterRemove(void);
+void rasterRemoveClient(const rasterClientT *client);
+void rasterSchedule(const rasterEntryT *entries, byte count);
+bool rasterService(void);
+void rasterStop(void);
+
+
+#pragma compile("f_raster.c")
+
+
+#endif
+#endif // RASTER_H
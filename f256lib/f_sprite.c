@@ -8,19 +8,86 @@
 
 
 #include "f256lib.h"
+#include <string.h>
 
 
 #define OFF_SPR_ADL_L    1
 #define OFF_SPR_POS_X_L  4
 #define OFF_SPR_POS_Y_L  6
 
+// Fields waiting to be written to a sprite's registers.
+#define SPRITE_DIRTY_CTRL  0x01
+#define SPRITE_DIRTY_ADDR  0x02
+#define SPRITE_DIRTY_POS   0x04
+#define SPRITE_DIRTY_ALL   0x07
 
-static byte _spriteCtl[64];
+
+typedef struct spriteStateS {
+	uint32_t address;
+	uint16_t x;
+	uint16_t y;
+	byte     ctrl;       // Including the visible bit.
+	byte     dirty;
+} spriteStateT;
+
+
+static spriteStateT _sprite[64];
+static byte         _spriteDirtyList[64];
+static byte         _spriteDirtyCount = 0;
+static bool         _spriteBuffered   = false;
+
+
+static void spriteWrite(byte s, byte what) {
+	uint16_t      reg = VKY_SP0_CTRL + ((uint16_t)s << 3);
+	spriteStateT *p   = &_sprite[s];
+
+	if (what & SPRITE_DIRTY_ADDR) POKEA(reg + OFF_SPR_ADL_L, p->address);
+	if (what & SPRITE_DIRTY_POS) {
+		POKEW(reg + OFF_SPR_POS_X_L, p->x);
+		POKEW(reg + OFF_SPR_POS_Y_L, p->y);
+	}
+	if (what & SPRITE_DIRTY_CTRL) POKE(reg, p->ctrl);
+}
+
+
+// Write now, or when buffered remember what changed for spriteCommit().
+static void spriteTouch(byte s, byte what) {
+	if (!_spriteBuffered) {
+		spriteWrite(s, what);
+		return;
+	}
+	if (!_sprite[s].dirty) _spriteDirtyList[_spriteDirtyCount++] = s;
+	_sprite[s].dirty |= what;
+}
+
+
+bool spriteCommit(void) {
+	byte mmu;
+	byte i;
+	byte s;
+
+	if (!_spriteDirtyCount) return false;
+
+	mmu = PEEK(MMU_IO_CTRL);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	while (PEEKW(RAST_ROW_L) < 480)
+		;
+
+	for (i = 0; i < _spriteDirtyCount; i++) {
+		s = _spriteDirtyList[i];
+		spriteWrite(s, _sprite[s].dirty);
+		_sprite[s].dirty = 0;
+	}
+	_spriteDirtyCount = 0;
+
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+
+	return true;
+}
 
 
 void spriteDefine(byte s, uint32_t address, byte size, byte CLUT, byte layer) {
-	uint16_t sprite = VKY_SP0_CTRL + (s * 8);
-	byte     sz;
+	byte sz;
 
 	switch (size) {
 		case 8:
@@ -37,40 +104,245 @@ void spriteDefine(byte s, uint32_t address, byte size, byte CLUT, byte layer) {
 			break;
 	}
 
-	_spriteCtl[s] = (sz << 5) | (layer << 3) | (CLUT << 1);
-	POKE(sprite, _spriteCtl[s]);
-	POKEA(sprite + OFF_SPR_ADL_L, address);
+	_sprite[s].ctrl    = (sz << 5) | (layer << 3) | (CLUT << 1);
+	_sprite[s].address = address;
+	spriteTouch(s, SPRITE_DIRTY_CTRL | SPRITE_DIRTY_ADDR);
 }
 
 
-void spriteSetPosition(byte s, uint16_t x, uint16_t y) {
-	uint16_t sprite = VKY_SP0_CTRL + (s * 8);
+// Pack the opaque pixels of a size x size 8bpp image into a collision
+// mask: one uint32_t per row, bit 31 the leftmost pixel.
+uint32_t spriteMakeMask(uint32_t image, byte size, uint32_t mask) {
+	byte     line[32];
+	uint32_t rows[32];
+	uint32_t bits;
+	byte     row;
+	byte     col;
+
+	for (row = 0; row < size; row++) {
+		farMemcpyNear(line, image, size);
+		bits = 0;
+		for (col = 0; col < size; col++) {
+			if (line[col]) bits |= 0x80000000UL >> col;
+		}
+		rows[row] = bits;
+		image    += size;
+	}
+	farMemcpy(mask, rows, (uint16_t)size << 2);
 
-	POKEW(sprite + OFF_SPR_POS_X_L, x);
-	POKEW(sprite + OFF_SPR_POS_Y_L, y);
+	return mask;
+}
+
+
+void spriteSetAddress(byte s, uint32_t address) {
+	if (_sprite[s].address == address) return;
+	_sprite[s].address = address;
+	spriteTouch(s, SPRITE_DIRTY_ADDR);
+}
+
+
+// While buffered, sprite changes only update the shadow table and
+// spriteCommit() writes the changed sprites during vertical blank.
+void spriteSetBuffered(bool b) {
+	if (!b) spriteCommit();
+	_spriteBuffered = b;
+}
+
+
+void spriteSetPosition(byte s, uint16_t x, uint16_t y) {
+	if (_sprite[s].x == x && _sprite[s].y == y) return;
+	_sprite[s].x = x;
+	_sprite[s].y = y;
+	spriteTouch(s, SPRITE_DIRTY_POS);
 }
 
 
 void spriteSetVisible(byte s, bool v) {
-	uint16_t sprite = VKY_SP0_CTRL + (s * 8);
+	byte ctrl = (_sprite[s].ctrl & 0xfe) | (byte)v;
 
-	POKE(sprite, _spriteCtl[s] | (byte)v);
+	if (_sprite[s].ctrl == ctrl) return;
+	_sprite[s].ctrl = ctrl;
+	spriteTouch(s, SPRITE_DIRTY_CTRL);
+}
+
+
+// Hide s and rewrite all of its registers from the shadow table, so the
+// hardware matches it again and the setters can trust it.
+static void spriteRelease(byte s) {
+	_sprite[s].ctrl &= 0xfe;
+	spriteTouch(s, SPRITE_DIRTY_ALL);
 }
 
 
 void spriteReset(void) {
 	byte x;
-	for (x=0; x<64; x++) spriteSetVisible(x, false);
+
+	for (x=0; x<64; x++) spriteRelease(x);
+}
+
+
+// Rotation frames
+// ---------------
+//
+// Sprites can't rotate, so rotated and scaled copies are rendered once
+// into far memory and the nearest one is shown.
+
+static byte _spr_rot_src[32 * 32];
+
+
+// Index of the frame nearest to angle among count frames spread evenly
+// around the circle.
+byte spriteFrameForAngle(uint16_t angle, byte count) {
+	return (byte)((mathUnsignedMultiply(angle, count) + 0x8000) >> 16) % count;
+}
+
+
+// Render src turned clockwise by angle and scaled, nearest neighbour,
+// about the image center.  Pixels mapped from outside src are transparent.
+void spriteRotate(uint32_t src, uint32_t dest, byte size, uint16_t angle, fix8T scale) {
+	fix8T   cs   = mathFix8Division(mathFix8Cos(angle), scale);
+	fix8T   sn   = mathFix8Division(mathFix8Sin(angle), scale);
+	int16_t half = (int16_t)size << 7;    // Half the size, 8.8.
+	int16_t lim  = (int16_t)size << 8;
+	int16_t d0   = 128 - half;            // First pixel center from the middle.
+	int16_t rowX = mathFix8Multiply(d0, cs) + mathFix8Multiply(d0, sn) + half;
+	int16_t rowY = mathFix8Multiply(d0, cs) - mathFix8Multiply(d0, sn) + half;
+	int16_t sx;
+	int16_t sy;
+	byte    line[32];
+	byte    x;
+	byte    y;
+
+	farMemcpyNear(_spr_rot_src, src, (uint16_t)size * size);
+
+	// Source = R(-angle) * dest / scale, stepped incrementally.
+	for (y = 0; y < size; y++) {
+		sx = rowX;
+		sy = rowY;
+		for (x = 0; x < size; x++) {
+			if (sx >= 0 && sx < lim && sy >= 0 && sy < lim) {
+				line[x] = _spr_rot_src[(byte)(sy >> 8) * size + (byte)(sx >> 8)];
+			} else {
+				line[x] = 0;
+			}
+			sx += cs;
+			sy -= sn;
+		}
+		farMemcpy(dest, line, size);
+		dest += size;
+		rowX += sn;
+		rowY += cs;
+	}
+}
+
+
+// count frames of src, frame i turned by i / count of a circle, stored
+// one after another at dest.
+void spriteRotateFrames(uint32_t src, uint32_t dest, byte size, byte count, fix8T scale) {
+	uint16_t bytes = (uint16_t)size * size;
+	byte     i;
+
+	for (i = 0; i < count; i++) {
+		spriteRotate(src, dest, size, (uint16_t)mathUnsignedDivision32((uint32_t)i << 16, count), scale);
+		dest += bytes;
+	}
 }
 
 
 // Sprite convenience layer
 // ------------------------
 
-static int  _spr_x[8], _spr_y[8];
-static byte _spr_enabled;
-static byte _spr_image[8];
-static byte _spr_color[8];
+static int      _spr_x[64], _spr_y[64];
+static byte     _spr_image[64];
+static byte     _spr_color[64];
+static uint32_t _spr_masks = 0;     // Far address of the mask table, 0 for none.
+
+#if SPR_ATLAS_ENTRIES
+// Expanded images cached by source and color, in image slots
+// SPR_ATLAS_FIRST and up.
+typedef struct spriteAtlasS {
+	const char *src;        // NULL when empty.
+	byte        color;
+	byte        users;      // Convenience sprites showing this entry.
+	uint16_t    used;       // _spr_clock at the last lookup.
+} spriteAtlasT;
+
+static spriteAtlasT _spr_atlas[SPR_ATLAS_ENTRIES];
+static uint16_t     _spr_clock = 0;
+
+#define SPR_IS_ATLAS(i)  ((i) >= SPR_ATLAS_FIRST && (i) < SPR_ATLAS_FIRST + SPR_ATLAS_ENTRIES)
+#endif
+
+static const byte _spr_nibble[16][4] = {
+	{ 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0xff }, { 0x00, 0x00, 0xff, 0x00 }, { 0x00, 0x00, 0xff, 0xff },
+	{ 0x00, 0xff, 0x00, 0x00 }, { 0x00, 0xff, 0x00, 0xff }, { 0x00, 0xff, 0xff, 0x00 }, { 0x00, 0xff, 0xff, 0xff },
+	{ 0xff, 0x00, 0x00, 0x00 }, { 0xff, 0x00, 0x00, 0xff }, { 0xff, 0x00, 0xff, 0x00 }, { 0xff, 0x00, 0xff, 0xff },
+	{ 0xff, 0xff, 0x00, 0x00 }, { 0xff, 0xff, 0x00, 0xff }, { 0xff, 0xff, 0xff, 0x00 }, { 0xff, 0xff, 0xff, 0xff }
+};
+
+
+// Point a convenience sprite at an image, keeping atlas users counted.
+static void spriteUseImage(byte sp, byte image) {
+#if SPR_ATLAS_ENTRIES
+	byte old = _spr_image[sp];
+
+	if (SPR_IS_ATLAS(old)) _spr_atlas[old - SPR_ATLAS_FIRST].users--;
+	if (SPR_IS_ATLAS(image)) _spr_atlas[image - SPR_ATLAS_FIRST].users++;
+#endif
+	_spr_image[sp] = image;
+}
+
+
+// Forget every cached expansion, for when a source image is changed in place.
+void spriteAtlasFlush(void) {
+#if SPR_ATLAS_ENTRIES
+	byte i;
+
+	for (i = 0; i < SPR_ATLAS_ENTRIES; i++) _spr_atlas[i].src = NULL;
+#endif
+}
+
+
+// Image slot holding src expanded in color.  A miss expands into the least
+// recently used entry no sprite is showing; SPR_NO_IMAGE if there is none
+// (always, without an atlas).
+#if !SPR_ATLAS_ENTRIES
+byte spriteAtlasImage(const char *src, byte color) {
+	return SPR_NO_IMAGE;
+}
+#else
+byte spriteAtlasImage(const char *src, byte color) {
+	spriteAtlasT *e;
+	uint16_t      age;
+	uint16_t      oldest = 0;
+	byte          victim = SPR_NO_IMAGE;
+	byte          i;
+
+	_spr_clock++;
+	for (i = 0; i < SPR_ATLAS_ENTRIES; i++) {
+		e = &_spr_atlas[i];
+		if (e->src == src && e->color == color && src) {
+			e->used = _spr_clock;
+			return SPR_ATLAS_FIRST + i;
+		}
+		if (!e->users) {
+			age = _spr_clock - e->used;
+			if (victim == SPR_NO_IMAGE || age > oldest) {
+				victim = i;
+				oldest = age;
+			}
+		}
+	}
+	if (victim == SPR_NO_IMAGE) return SPR_NO_IMAGE;
+
+	e        = &_spr_atlas[victim];
+	e->src   = src;
+	e->color = color;
+	e->used  = _spr_clock;
+
+	return spriteExpand(src, SPR_ATLAS_FIRST + victim, color);
+}
+#endif
 
 
 void spriteInitClut(void) {
@@ -89,42 +361,92 @@ void spriteInitClut(void) {
 }
 
 
+// Written straight into far memory through the swap window.  Each source
+// nibble selects four 0x00/0xff bytes which are ANDed with the color.
 byte spriteExpand(const char *src, byte slot, byte color) {
-	uint32_t dest = SPR_DATA_BASE + (uint32_t)slot * SPR_IMG_SIZE;
-	byte row, col;
-
-	for (row = 0; row < 21; row++) {
-		byte b0 = (byte)src[row * 3 + 0];
-		byte b1 = (byte)src[row * 3 + 1];
-		byte b2 = (byte)src[row * 3 + 2];
+	uint32_t    dest   = SPR_DATA_BASE + mathUnsignedMultiply(slot, SPR_IMG_SIZE);
+	byte        block  = dest / EIGHTK;
+	uint16_t    offset = dest & 0x1FFF;
+	uint16_t    chunk;
+	uint32_t    mask[24];
+	byte        line[24];
+	byte       *out;
+	const byte *n;
+	byte        row, i, b;
+
+	SWAP_IO_SETUP();
+	POKE_MEMMAP(SWAP_SLOT, block);
+
+	for (row = 0; row < 24; row++) {
+		// A row that runs off the end of the window is built aside.
+		out = (offset + 24 <= EIGHTK) ? (byte *)(SWAP_ADDR + offset) : line;
+
+		if (row < 21) {
+			for (i = 0; i < 3; i++) {
+				b      = (byte)*src++;
+				n      = _spr_nibble[b >> 4];
+				out[0] = n[0] & color;
+				out[1] = n[1] & color;
+				out[2] = n[2] & color;
+				out[3] = n[3] & color;
+				n      = _spr_nibble[b & 15];
+				out[4] = n[0] & color;
+				out[5] = n[1] & color;
+				out[6] = n[2] & color;
+				out[7] = n[3] & color;
+				out   += 8;
+			}
+			mask[row] = ((uint32_t)(byte)src[-3] << 24) | ((uint32_t)(byte)src[-2] << 16) | ((uint16_t)(byte)src[-1] << 8);
+		} else {
+			// Bottom 3 rows: transparent
+			memset(out, 0, 24);
+			mask[row] = 0;
+		}
 
-		for (col = 0; col < 8; col++)
-			FAR_POKE(dest + row * 24 + col, (b0 & (0x80 >> col)) ? color : 0);
-		for (col = 0; col < 8; col++)
-			FAR_POKE(dest + row * 24 + 8 + col, (b1 & (0x80 >> col)) ? color : 0);
-		for (col = 0; col < 8; col++)
-			FAR_POKE(dest + row * 24 + 16 + col, (b2 & (0x80 >> col)) ? color : 0);
+		if (offset + 24 <= EIGHTK) {
+			offset += 24;
+		} else {
+			chunk = EIGHTK - offset;
+			memcpy((byte *)(SWAP_ADDR + offset), line, chunk);
+			POKE_MEMMAP(SWAP_SLOT, ++block);
+			memcpy((byte *)SWAP_ADDR, line + chunk, 24 - chunk);
+			offset = 24 - chunk;
+		}
+		if (offset == EIGHTK) {
+			POKE_MEMMAP(SWAP_SLOT, ++block);
+			offset = 0;
+		}
 	}
 
-	// Bottom 3 rows: transparent
-	for (row = 21; row < 24; row++)
-		for (col = 0; col < 24; col++)
-			FAR_POKE(dest + row * 24 + col, 0);
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+
+	if (_spr_masks) farMemcpy(spriteImageMask(slot), mask, SPR_MASK_SIZE);
 
 	return slot;
 }
 
 
+uint32_t spriteImageMask(byte image) {
+	return _spr_masks + mathUnsignedMultiply(image, SPR_MASK_SIZE);
+}
+
+
 void spriteInit(void) {
 	byte i;
 
-	_spr_enabled = 0;
-	for (i = 0; i < 8; i++) {
+	for (i = 0; i < 64; i++) {
 		_spr_x[i] = 0;
 		_spr_y[i] = 0;
 		_spr_image[i] = 0;
 		_spr_color[i] = 0;
 	}
+#if SPR_ATLAS_ENTRIES
+	for (i = 0; i < SPR_ATLAS_ENTRIES; i++) {
+		_spr_atlas[i].src   = NULL;
+		_spr_atlas[i].users = 0;
+	}
+#endif
 
 	spriteInitClut();
 
@@ -138,18 +460,13 @@ void spriteInit(void) {
 
 void spriteSet(byte sp, bool show, int xpos, int ypos,
                 byte image, byte color) {
-	sp &= 7;
+	sp &= 63;
 	_spr_x[sp] = xpos;
 	_spr_y[sp] = ypos;
-	_spr_image[sp] = image;
+	spriteUseImage(sp, image);
 	_spr_color[sp] = color;
 
-	if (show)
-		_spr_enabled |= (1 << sp);
-	else
-		_spr_enabled &= ~(1 << sp);
-
-	uint32_t addr = SPR_DATA_BASE + (uint32_t)image * SPR_IMG_SIZE;
+	uint32_t addr = SPR_DATA_BASE + mathUnsignedMultiply(image, SPR_IMG_SIZE);
 	spriteDefine(sp, addr, 24, 0, 0);
 	spriteSetPosition(sp, (uint16_t)(xpos + SPR_OFFSET_X),
 	                      (uint16_t)(ypos + SPR_OFFSET_Y));
@@ -158,7 +475,7 @@ void spriteSet(byte sp, bool show, int xpos, int ypos,
 
 
 void spriteMove(byte sp, int xpos, int ypos) {
-	sp &= 7;
+	sp &= 63;
 	_spr_x[sp] = xpos;
 	_spr_y[sp] = ypos;
 	spriteSetPosition(sp, (uint16_t)(xpos + SPR_OFFSET_X),
@@ -166,29 +483,62 @@ void spriteMove(byte sp, int xpos, int ypos) {
 }
 
 
+// Fill images first .. first + count - 1 with turned copies of image.
+void spriteRotateImage(byte image, byte first, byte count, fix8T scale) {
+	spriteRotateFrames(SPR_DATA_BASE + mathUnsignedMultiply(image, SPR_IMG_SIZE),
+	                   SPR_DATA_BASE + mathUnsignedMultiply(first, SPR_IMG_SIZE), 24, count, scale);
+}
+
+
 void spriteSetImage(byte sp, byte image) {
-	sp &= 7;
-	_spr_image[sp] = image;
-	uint32_t addr = SPR_DATA_BASE + (uint32_t)image * SPR_IMG_SIZE;
-	spriteDefine(sp, addr, 24, 0, 0);
-	spriteSetVisible(sp, (_spr_enabled & (1 << sp)) ? true : false);
+	sp &= 63;
+	spriteUseImage(sp, image);
+	spriteSetAddress(sp, SPR_DATA_BASE + mathUnsignedMultiply(image, SPR_IMG_SIZE));
 }
 
 
+// Shows the cached expansion of src in newColor, expanding it only on a
+// miss.  Without an atlas, or with every entry on screen, it recolors the
+// sprite's own image in place.
 void spriteRecolor(byte sp, const char *src, byte newColor) {
-	sp &= 7;
+	byte image;
+
+	sp &= 63;
 	_spr_color[sp] = newColor;
-	spriteExpand(src, _spr_image[sp], newColor);
+
+	image = spriteAtlasImage(src, newColor);
+	if (image == SPR_NO_IMAGE) {
+		image = _spr_image[sp];
+#if SPR_ATLAS_ENTRIES
+		if (SPR_IS_ATLAS(image)) {
+			_spr_atlas[image - SPR_ATLAS_FIRST].src   = src;
+			_spr_atlas[image - SPR_ATLAS_FIRST].color = newColor;
+		}
+#endif
+		spriteExpand(src, image, newColor);
+		return;
+	}
+
+	spriteUseImage(sp, image);
+	spriteSetAddress(sp, SPR_DATA_BASE + mathUnsignedMultiply(image, SPR_IMG_SIZE));
+}
+
+
+// From now on spriteExpand also writes each image's collision mask to
+// far memory at base + image * SPR_MASK_SIZE.  0 turns this off.
+void spriteSetMaskBase(uint32_t base) {
+	_spr_masks = base;
+}
+
+
+// Show the frame of a spriteRotateImage() set nearest to angle.
+void spriteSetAngle(byte sp, byte first, byte count, uint16_t angle) {
+	spriteSetImage(sp, first + spriteFrameForAngle(angle, count));
 }
 
 
 void spriteShow(byte sp, bool show) {
-	sp &= 7;
-	if (show)
-		_spr_enabled |= (1 << sp);
-	else
-		_spr_enabled &= ~(1 << sp);
-	spriteSetVisible(sp, show);
+	spriteSetVisible(sp & 63, show);
 }
 
 
@@ -197,10 +547,10 @@ byte spriteCheckCollisions(void) {
 	byte i, j;
 
 	for (i = 0; i < 8; i++) {
-		if (!(_spr_enabled & (1 << i)))
+		if (!(_sprite[i].ctrl & 1))
 			continue;
 		for (j = i + 1; j < 8; j++) {
-			if (!(_spr_enabled & (1 << j)))
+			if (!(_sprite[j].ctrl & 1))
 				continue;
 
 			int dx = _spr_x[i] - _spr_x[j];
@@ -218,4 +568,327 @@ byte spriteCheckCollisions(void) {
 }
 
 
+#ifndef WITHOUT_RASTER
+// Sprite multiplexer
+// ------------------
+//
+// Logical sprites are sorted by Y each frame and dealt out to a range of
+// hardware slots.  A slot's first sprite of the frame is loaded during
+// vertical blank; later ones are loaded from line interrupts after the
+// slot's previous sprite has been drawn.  Each interrupt performs at most
+// SPRITE_MUX_BATCH loads.  Sprites that can't be placed are dropped for
+// the frame and counted.
+//
+// The multiplexer is an f_raster client, so its loads share the line
+// interrupt with rasterSchedule() and run from the IRQ once rasterInstall()
+// has been called.  spriteMuxFrame() builds the plan for the next frame;
+// the plan in use is replayed every frame until a new one replaces it.
+
+typedef struct spriteMuxS {
+	uint32_t address;
+	uint16_t x;          // Position in the current plan.
+	uint16_t y;
+	uint16_t nextX;      // Position for the next spriteMuxFrame().
+	uint16_t nextY;
+	byte     ctrl;       // Visible bit clear.
+	byte     height;
+	bool     shown;
+} spriteMuxT;
+
+
+static spriteMuxT    _mux[SPRITE_MUX_MAX];
+static byte          _muxOrder[SPRITE_MUX_MAX];       // Logical sprites by Y.
+static byte          _muxFirstSlot = 0;
+static byte          _muxSlots     = 0;
+static byte          _muxPreSprite[64];               // Loads made in vblank, by slot.
+static byte          _muxPreCount  = 0;
+static byte          _muxEvSlot[SPRITE_MUX_MAX];      // Loads made from interrupts.
+static byte          _muxEvSprite[SPRITE_MUX_MAX];
+static int16_t       _muxIrqLine[SPRITE_MUX_MAX];
+static byte          _muxIrqEnd[SPRITE_MUX_MAX];      // One past the interrupt's last load.
+static byte          _muxIrqCount  = 0;
+static volatile byte _muxIrqNext   = 0;
+static volatile bool _muxReady     = false;           // New plan waiting for vblank.
+static volatile bool _muxBuilding  = false;           // Plan being rebuilt, don't use it.
+static uint16_t      _muxOverflowY = 0xffff;
+
+static void    spriteMuxBlank(void);
+static int16_t spriteMuxFirst(void);
+static int16_t spriteMuxLine(void);
+
+static const rasterClientT _muxClient = { spriteMuxBlank, spriteMuxFirst, spriteMuxLine };
+
+
+// Caller has mapped I/O page 0.
+static void spriteMuxHide(void) {
+	byte i;
+
+	for (i = 0; i < _muxSlots; i++) POKE(VKY_SP0_CTRL + ((uint16_t)(_muxFirstSlot + i) << 3), 0);
+}
+
+
+static void spriteMuxLoad(byte slot, byte n) {
+	uint16_t    reg = VKY_SP0_CTRL + ((uint16_t)(_muxFirstSlot + slot) << 3);
+	spriteMuxT *m   = &_mux[n];
+
+	POKEA(reg + OFF_SPR_ADL_L, m->address);
+	POKEW(reg + OFF_SPR_POS_X_L, m->x);
+	POKEW(reg + OFF_SPR_POS_Y_L, m->y);
+	POKE(reg, m->ctrl | 1);
+}
+
+
+// Vertical blank: start the newest plan (or replay the last one) by
+// loading each slot's first sprite.
+static void spriteMuxBlank(void) {
+	byte i;
+
+	_muxIrqNext = 0;
+	if (_muxBuilding) {
+		spriteMuxHide();
+		return;
+	}
+
+	for (i = 0; i < _muxPreCount; i++) spriteMuxLoad(i, _muxPreSprite[i]);
+	for (; i < _muxSlots; i++) POKE(VKY_SP0_CTRL + ((uint16_t)(_muxFirstSlot + i) << 3), 0);
+	_muxReady = false;
+}
+
+
+static int16_t spriteMuxFirst(void) {
+	return !_muxBuilding && _muxIrqCount ? _muxIrqLine[0] : RASTER_NO_LINE;
+}
+
+
+// The beam reached the pending interrupt's line: make its loads.
+static int16_t spriteMuxLine(void) {
+	byte i = _muxIrqNext ? _muxIrqEnd[_muxIrqNext - 1] : 0;
+
+	for (; i < _muxIrqEnd[_muxIrqNext]; i++) spriteMuxLoad(_muxEvSlot[i], _muxEvSprite[i]);
+
+	return ++_muxIrqNext < _muxIrqCount ? _muxIrqLine[_muxIrqNext] : RASTER_NO_LINE;
+}
+
+
+// Build the frame's load list.  Returns the number of sprites dropped.
+static byte spriteMuxSchedule(void) {
+	int16_t free[64];      // Raster line at which each slot is done drawing.
+	int16_t top;
+	int16_t last;
+	byte    dropped = 0;
+	byte    ev      = 0;
+	byte    first   = 0;
+	byte    i;
+	byte    n;
+	byte    s;
+	byte    pick;
+
+	_muxPreCount  = 0;
+	_muxIrqCount  = 0;
+	_muxOverflowY = 0xffff;
+
+	for (i = 0; i < SPRITE_MUX_MAX; i++) {
+		n = _muxOrder[i];
+		if (!_mux[n].shown) continue;
+
+		// A slot not yet used this frame is loaded in vblank for free.
+		if (_muxPreCount < _muxSlots) {
+			s                = _muxPreCount++;
+			_muxPreSprite[s] = n;
+			free[s]          = SPRITE_MUX_LINE(_mux[n].y + _mux[n].height);
+			continue;
+		}
+
+		top  = SPRITE_MUX_LINE(_mux[n].y) - SPRITE_MUX_LEAD;
+		pick = 0xff;
+
+		// Join the latest interrupt if it has room and a slot is free by then.
+		if (_muxIrqCount && ev - first < SPRITE_MUX_BATCH) {
+			last = _muxIrqLine[_muxIrqCount - 1];
+			for (s = 0; s < _muxSlots; s++) {
+				if (free[s] <= last) {
+					pick = s;
+					break;
+				}
+			}
+			if (pick != 0xff) _muxIrqEnd[_muxIrqCount - 1] = ev + 1;
+		}
+
+		// Otherwise start a new interrupt as late as possible.
+		if (pick == 0xff && (!_muxIrqCount || top >= _muxIrqLine[_muxIrqCount - 1] + SPRITE_MUX_GAP)) {
+			for (s = 0; s < _muxSlots; s++) {
+				if (free[s] <= top) {
+					pick = s;
+					break;
+				}
+			}
+			if (pick != 0xff) {
+				first                     = ev;
+				_muxIrqLine[_muxIrqCount] = top;
+				_muxIrqEnd[_muxIrqCount]  = ev + 1;
+				_muxIrqCount++;
+			}
+		}
+
+		if (pick == 0xff) {
+			if (_muxOverflowY == 0xffff) _muxOverflowY = _mux[n].y;
+			dropped++;
+			continue;
+		}
+
+		free[pick]       = SPRITE_MUX_LINE(_mux[n].y + _mux[n].height);
+		_muxEvSlot[ev]   = pick;
+		_muxEvSprite[ev] = n;
+		ev++;
+	}
+
+	return dropped;
+}
+
+
+// Sort by Y.  The order changes little between frames, so insertion sort
+// runs in close to linear time.
+static void spriteMuxSort(void) {
+	byte     i;
+	byte     j;
+	byte     n;
+	uint16_t y;
+
+	for (i = 1; i < SPRITE_MUX_MAX; i++) {
+		n = _muxOrder[i];
+		y = _mux[n].y;
+		for (j = i; j > 0 && _mux[_muxOrder[j - 1]].y > y; j--) _muxOrder[j] = _muxOrder[j - 1];
+		_muxOrder[j] = n;
+	}
+}
+
+
+void spriteMuxDefine(byte n, uint32_t address, byte size, byte CLUT, byte layer) {
+	byte sz;
+
+	switch (size) {
+		case 8:
+			sz = 3;
+			break;
+		case 16:
+			sz = 2;
+			break;
+		case 24:
+			sz = 1;
+			break;
+		default:
+			sz   = 0;
+			size = 32;
+			break;
+	}
+
+	_mux[n].ctrl    = (sz << 5) | (layer << 3) | (CLUT << 1);
+	_mux[n].height  = size;
+	_mux[n].address = address;
+}
+
+
+// Build the plan for the next frame from the positions given since the
+// last call.  Waits only while the current frame still has loads to make,
+// or while the previous plan hasn't been picked up by a vertical blank.
+// Returns the number of sprites dropped because their band was over
+// capacity.
+byte spriteMuxFrame(void) {
+	byte dropped;
+	byte i;
+
+	for (;;) {
+		__asm volatile { sei }
+		if (!_muxReady && _muxIrqNext >= _muxIrqCount) {
+			_muxBuilding = true;
+			__asm volatile { cli }
+			break;
+		}
+		__asm volatile { cli }
+		rasterService();
+	}
+
+	for (i = 0; i < SPRITE_MUX_MAX; i++) {
+		_mux[i].x = _mux[i].nextX;
+		_mux[i].y = _mux[i].nextY;
+	}
+	spriteMuxSort();
+	dropped = spriteMuxSchedule();
+
+	_muxReady    = true;
+	_muxBuilding = false;
+
+	return dropped;
+}
+
+
+// Hand hardware slots first .. first + count - 1 to the multiplexer; a
+// count of 0 stops it.  Slots it had before are hidden.
+void spriteMuxInit(byte first, byte count) {
+	byte mmu;
+	byte i;
+
+	rasterRemoveClient(&_muxClient);
+
+	mmu = PEEK(MMU_IO_CTRL);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	spriteMuxHide();
+	// The mux wrote these slots behind the shadow table's back.
+	for (i = 0; i < _muxSlots; i++) spriteRelease(_muxFirstSlot + i);
+	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+
+	_muxFirstSlot = first;
+	_muxSlots     = count;
+	_muxPreCount  = 0;
+	_muxIrqCount  = 0;
+	_muxIrqNext   = 0;
+	_muxReady     = false;
+	_muxBuilding  = false;
+
+	for (i = 0; i < SPRITE_MUX_MAX; i++) {
+		_muxOrder[i]   = i;
+		_mux[i].shown  = false;
+		_mux[i].y      = 0;
+		_mux[i].nextY  = 0;
+		_mux[i].height = 32;
+	}
+
+	if (count) rasterAddClient(&_muxClient);
+}
+
+
+void spriteMuxMove(byte n, uint16_t x, uint16_t y) {
+	_mux[n].nextX = x;
+	_mux[n].nextY = y;
+}
+
+
+// Y of the first logical sprite dropped last frame, or 0xffff.
+uint16_t spriteMuxOverflowY(void) {
+	return _muxOverflowY;
+}
+
+
+// Only needed without rasterInstall(): poll until the plan from the last
+// spriteMuxFrame() has been shown down to its last load.
+void spriteMuxRun(void) {
+	while (spriteMuxService())
+		;
+}
+
+
+// Polls rasterService() once.  True while the newest plan is still
+// waiting for vertical blank or has loads left to make this frame.
+bool spriteMuxService(void) {
+	rasterService();
+	return _muxReady || _muxIrqNext < _muxIrqCount;
+}
+
+
+void spriteMuxShow(byte n, bool show) {
+	_mux[n].shown = show;
+}
+#endif
+
+
 #endif
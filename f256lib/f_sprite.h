@@ -13,18 +13,80 @@
 
 
 void spriteDefine(byte s, uint32_t address, byte size, byte CLUT, byte layer);
+uint32_t spriteMakeMask(uint32_t image, byte size, uint32_t mask);
+void spriteSetAddress(byte s, uint32_t address);
 void spriteSetPosition(byte s, uint16_t x, uint16_t y);
 void spriteSetVisible(byte s, bool v);
 void spriteReset(void);
 
+// Shadow registers: while buffered, changes are held until spriteCommit()
+// writes the sprites that changed during vertical blank.
+void spriteSetBuffered(bool b);
+bool spriteCommit(void);
+
+
+#ifndef WITHOUT_RASTER
+// Sprite multiplexer
+// ------------------
+// Shares the line interrupt with f_raster as one of its clients.  After
+// rasterInstall() it runs from the IRQ; otherwise poll spriteMuxRun()
+// after each spriteMuxFrame().
+
+#ifndef SPRITE_MUX_MAX
+#define SPRITE_MUX_MAX    96   // Logical sprites.
+#endif
+#ifndef SPRITE_MUX_BATCH
+#define SPRITE_MUX_BATCH  8    // Most slot loads made by one line interrupt.
+#endif
+#ifndef SPRITE_MUX_LEAD
+#define SPRITE_MUX_LEAD   4    // Raster lines between loading a slot and its sprite's top.
+#endif
+#ifndef SPRITE_MUX_GAP
+#define SPRITE_MUX_GAP    6    // Fewest raster lines between two line interrupts.
+#endif
+
+// Raster line of sprite row y (sprite rows are doubled on the 480 line raster).
+#define SPRITE_MUX_LINE(y)  ((int16_t)(((int16_t)(y) - 32) << 1))
+
+void     spriteMuxInit(byte first, byte count);
+void     spriteMuxDefine(byte n, uint32_t address, byte size, byte CLUT, byte layer);
+void     spriteMuxMove(byte n, uint16_t x, uint16_t y);
+void     spriteMuxShow(byte n, bool show);
+byte     spriteMuxFrame(void);
+bool     spriteMuxService(void);
+void     spriteMuxRun(void);
+uint16_t spriteMuxOverflowY(void);
+#endif
+
+
+// Rotation frames
+// ---------------
+
+byte spriteFrameForAngle(uint16_t angle, byte count);
+void spriteRotate(uint32_t src, uint32_t dest, byte size, uint16_t angle, fix8T scale);
+void spriteRotateFrames(uint32_t src, uint32_t dest, byte size, byte count, fix8T scale);
+
 
 // Sprite convenience layer
 // ------------------------
 
-// Sprite data address in system bus memory (above CPU space)
+// Sprite data address in system bus memory (above CPU space).  Image n
+// lives at SPR_DATA_BASE + n * SPR_IMG_SIZE: the numbered images take
+// 0x10000-0x123FF, and any atlas entries follow from 0x12400 (32 entries
+// would reach 0x16BFF).
 #define SPR_DATA_BASE    0x10000UL
 #define SPR_IMG_SIZE     576       // 24x24 @ 8bpp
 #define SPR_MAX_IMAGES   16
+#define SPR_MASK_SIZE    96        // 24 rows, 32 bits each
+
+// Cached expansions used by spriteRecolor, in the image slots after the
+// numbered ones.  Off unless defined; without it spriteRecolor recolors
+// the sprite's image in place.
+#ifndef SPR_ATLAS_ENTRIES
+#define SPR_ATLAS_ENTRIES 0
+#endif
+#define SPR_ATLAS_FIRST  SPR_MAX_IMAGES
+#define SPR_NO_IMAGE     0xff
 
 // TinyVicky sprite coordinates: visible area starts at (32,32)
 #define SPR_OFFSET_X     32
@@ -32,11 +94,17 @@ void spriteReset(void);
 
 void spriteInitClut(void);
 byte spriteExpand(const char *src, byte slot, byte color);
+void spriteSetMaskBase(uint32_t base);
+uint32_t spriteImageMask(byte image);
 void spriteInit(void);
 void spriteSet(byte sp, bool show, int xpos, int ypos, byte image, byte color);
 void spriteMove(byte sp, int xpos, int ypos);
 void spriteSetImage(byte sp, byte image);
 void spriteRecolor(byte sp, const char *src, byte newColor);
+void spriteRotateImage(byte image, byte first, byte count, fix8T scale);
+void spriteSetAngle(byte sp, byte first, byte count, uint16_t angle);
+byte spriteAtlasImage(const char *src, byte color);
+void spriteAtlasFlush(void);
 void spriteShow(byte sp, bool show);
 byte spriteCheckCollisions(void);
 
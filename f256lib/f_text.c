@@ -8,6 +8,7 @@
 
 
 #include "f256lib.h"
+#include <string.h>
 
 
 colorT textColors[16] = {
@@ -37,9 +38,21 @@ static byte  _col     = 0;
 static byte  _fcolor  = 15;
 static byte  _bcolor  = 0;
 static byte  _ccolor  = 240;
+static uint16_t _rowAddr = TEXT_MATRIX;   // Text matrix address of _row.
+
+// Optional buffering of textPutChar / f256putchar output.
+static char  _outBuf[TEXT_OUT_BUFFER];
+static byte  _outLen      = 0;
+static bool  _outBuffered = false;
+
+#define textFlushPending() do { \
+	if (_outLen) textFlushOutput(); \
+} while(0)
 
 
 void textClear(void) {
+	textFlushPending();
+
 	byte           mmu   = PEEK(MMU_IO_CTRL);
 	int16_t        i;
 	int16_t        count = mathUnsignedMultiply(_MAX_COL, _MAX_ROW);
@@ -86,12 +99,15 @@ void textEnableBackgroundColors(bool b) {
 
 
 void textGetXY(byte *x, byte *y) {
+	textFlushPending();
 	*x = _col;
 	*y = _row;
 }
 
 
 void textGotoXY(byte x, byte y) {
+	textFlushPending();
+
 	_col = x;
 	POKE(VKY_CRSR_X_L, _col);
 	POKE(VKY_CRSR_X_H, 0);
@@ -99,173 +115,153 @@ void textGotoXY(byte x, byte y) {
 	_row = y;
 	POKE(VKY_CRSR_Y_L, _row);
 	POKE(VKY_CRSR_Y_H, 0);
+
+	_rowAddr = TEXT_MATRIX + (uint16_t)mathUnsignedMultiply(_MAX_COL, _row);
 }
 
 
-void textPrint(const char *message) {
-	int16_t  x      = 0;
-	int16_t  i      = 0;
-	int16_t  j      = 0;
-	int16_t  m      = 0;
-	byte     mmu    = PEEK(MMU_IO_CTRL);
-	volatile byte *vram = (byte *)mathUnsignedAddition(TEXT_MATRIX, mathUnsignedMultiply(_MAX_COL, _row));
-	volatile byte *save = 0;
-
-	while (message[x] != 0) {
-		switch (message[x]) {
-			default:
-				POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-				vram[_col] = _ccolor;
-				POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-				vram[_col] = message[x];
-				_col++;
-				if (_col != _MAX_COL) break;
-				// Fall through.
-			case 10:
-			case 13:
-				_col = 0;
-				_row++;
-				if (_row == _MAX_ROW) {
-					vram = (byte *)TEXT_MATRIX;
-					m = _MAX_COL * (_MAX_ROW - 1);
-					POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-					for (j=0; j<2; j++) {
-						for (i = 0; i < m; i++) {
-							vram[i] = vram[i + _MAX_COL];
-						}
-						POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-					}
-					vram += i;
-					save = vram;
-					POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-					for (i = 0; i < _MAX_COL; i++) *vram++ = _ccolor;
-					POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-					vram = save;
-					for (i = 0; i < _MAX_COL; i++) *vram++ = 32;
-					_row--;
-					vram = (byte *)mathUnsignedAddition(TEXT_MATRIX, (_MAX_ROW - 1));
-				} else {
-					vram += _MAX_COL;
-				}
-				break;
+// Move to the start of the next row, scrolling at the bottom.
+static void textNewline(void) {
+	_col = 0;
+	_row++;
+	if (_row >= _MAX_ROW) {
+		textScrollUp();
+		_row = _MAX_ROW - 1;
+	} else {
+		_rowAddr += _MAX_COL;
+	}
+}
+
+
+// Output engine behind textPrint, textPutChar and the buffered path.
+// Each run of printable characters on a row is written as one block of
+// glyphs under MMU_IO_TEXT followed by one block of attributes under
+// MMU_IO_COLOR.  The hardware cursor is updated once at the end.
+static void textEmit(const char *s, uint16_t len) {
+	byte           mmu = PEEK(MMU_IO_CTRL);
+	byte           run;
+	byte           room;
+	byte           i;
+	volatile byte *vram;
+
+	while (len) {
+		if (*s == 10 || *s == 13) {
+			textNewline();
+			s++;
+			len--;
+			continue;
 		}
-		x++;
+
+		room = _MAX_COL - _col;
+		for (run = 0; run < room && run < len; run++) {
+			if (s[run] == 10 || s[run] == 13) break;
+		}
+
+		vram = (byte *)(_rowAddr + _col);
+		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
+		for (i = 0; i < run; i++) vram[i] = s[i];
+		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
+		for (i = 0; i < run; i++) vram[i] = _ccolor;
+
+		_col += run;
+		s    += run;
+		len  -= run;
+		if (_col == _MAX_COL) textNewline();
 	}
 
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	POKE(VKY_CRSR_X_L, _col);
+	POKE(VKY_CRSR_X_H, 0);
+	POKE(VKY_CRSR_Y_L, _row);
+	POKE(VKY_CRSR_Y_H, 0);
 	POKE_MEMMAP(MMU_IO_CTRL, mmu);
-
-	textGotoXY(_col, _row);
 }
 
 
-void textPrintInt(int32_t value){
-	if (value < 0) {
-		textPrint("-");
-		value = -value;
-	}
-	textPrintUInt(value);
+static void textEmitChar(char c) {
+	textEmit(&c, 1);
 }
 
 
-void textPrintUInt(uint32_t value){
-	char c[2];
+void textFlushOutput(void) {
+	byte n = _outLen;
 
-	if (value > 9) {
-		if (value > 65535) {
-			textPrintUInt(value / 10);
-		} else {
-			textPrintUInt(mathUnsignedDivision(value, 10));
-		}
+	if (n) {
+		_outLen = 0;
+		textEmit(_outBuf, n);
 	}
-
-	c[0] = '0' + (value % 10);
-	c[1] = 0;
-	textPrint(c);
 }
 
 
-void textScrollUp(void) {
-	volatile byte *vram = (byte *)TEXT_MATRIX;
-	uint16_t       total = (uint16_t)_MAX_COL * (uint16_t)_MAX_ROW;
-	uint16_t       copy_count = total - _MAX_COL;
-	uint16_t       i;
-
-	// Scroll text matrix
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-	for (i = 0; i < copy_count; i++)
-		vram[i] = vram[i + _MAX_COL];
-	for (i = copy_count; i < total; i++)
-		vram[i] = 32;
-
-	// Scroll color matrix
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-	vram = (byte *)TEXT_MATRIX;
-	for (i = 0; i < copy_count; i++)
-		vram[i] = vram[i + _MAX_COL];
-	for (i = copy_count; i < total; i++)
-		vram[i] = _ccolor;
+void textPrint(const char *message) {
+	uint16_t len = 0;
 
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	textFlushPending();
+	while (message[len]) len++;
+	textEmit(message, len);
 }
 
 
-static void textAdvanceCursor(void) {
-	_col++;
-	if (_col >= _MAX_COL) {
-		_col = 0;
-		_row++;
-		if (_row >= _MAX_ROW) {
-			textScrollUp();
-			_row = _MAX_ROW - 1;
-		}
+void textPrintInt(int32_t value){
+	if (value < 0) {
+		textPutChar('-');
+		value = -value;
 	}
+	textPrintUInt(value);
 }
 
 
-static void textNewline(void) {
-	_col = 0;
-	_row++;
-	if (_row >= _MAX_ROW) {
-		textScrollUp();
-		_row = _MAX_ROW - 1;
+void textPrintUInt(uint32_t value){
+	char     buf[11];
+	byte     i = 10;
+	uint16_t r;
+
+	buf[10] = 0;
+	while (value > 65535) {
+		value = mathUnsignedDivisionRemainder32(value, 10, &r);
+		buf[--i] = '0' + r;
 	}
+	do {
+		value = mathUnsignedDivisionRemainder((uint16_t)value, 10, &r);
+		buf[--i] = '0' + r;
+	} while (value);
+
+	textFlushPending();
+	textEmit(&buf[i], 10 - i);
 }
 
 
-void textPutChar(char c) {
-	if (c == 10 || c == 13) {
-		textNewline();
-	} else {
-		volatile byte *vram = (byte *)mathUnsignedAddition(TEXT_MATRIX, mathUnsignedMultiply(_MAX_COL, _row));
+void textScrollUp(void) {
+	textScrollRowsUp(0, _MAX_ROW - 1);
+}
 
-		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-		vram[_col] = _ccolor;
-		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-		vram[_col] = (byte)c;
-		POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
 
-		textAdvanceCursor();
+// Immediate unless buffering is on, in which case characters collect
+// until a newline, a full buffer, or any call that moves the cursor.
+void textPutChar(char c) {
+	if (_outBuffered) {
+		_outBuf[_outLen++] = c;
+		if (c == 10 || c == 13 || _outLen == TEXT_OUT_BUFFER) textFlushOutput();
+		return;
 	}
-	// Update hardware cursor
-	byte mmu = PEEK(MMU_IO_CTRL);
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
-	POKE(VKY_CRSR_X_L, _col);
-	POKE(VKY_CRSR_X_H, 0);
-	POKE(VKY_CRSR_Y_L, _row);
-	POKE(VKY_CRSR_Y_H, 0);
-	POKE_MEMMAP(MMU_IO_CTRL, mmu);
+	textEmitChar(c);
 }
 
 
 void textPrintHex(uint32_t value, byte digits) {
+	char buf[9];
 	byte i;
+	byte nibble;
+
+	if (digits > 8) digits = 8;
 	for (i = digits; i > 0; i--) {
-		byte nibble = (byte)((value >> ((i - 1) * 4)) & 0x0f);
-		if (nibble < 10)
-			textPutChar('0' + nibble);
-		else
-			textPutChar('a' + nibble - 10);
+		nibble = (byte)(value & 0x0f);
+		buf[i - 1] = nibble < 10 ? '0' + nibble : 'a' + nibble - 10;
+		value >>= 4;
 	}
+
+	textFlushPending();
+	textEmit(buf, digits);
 }
 
 
@@ -296,17 +292,19 @@ void textPrintFloat(float val, byte decimals) {
 #ifndef WITHOUT_KEYBOARD
 void textReadLine(char *buf, byte maxlen) {
 	byte i = 0;
+
+	textFlushPending();
 	for (;;) {
 		char ch = keyboardGetChar();
 		if (ch == '\r' || ch == '\n') {
 			buf[i] = 0;
-			textPutChar('\n');
+			textEmitChar('\n');
 			return;
 		} else if (ch == '\b') {
 			if (i > 0) {
 				i--;
 				_col--;
-				textPutChar(' ');
+				textEmitChar(' ');
 				_col--;
 				byte mmu = PEEK(MMU_IO_CTRL);
 				POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
@@ -317,7 +315,7 @@ void textReadLine(char *buf, byte maxlen) {
 			if (ch >= 'a' && ch <= 'z')
 				ch = ch - 'a' + 'A';
 			buf[i++] = ch;
-			textPutChar(ch);
+			textEmitChar(ch);
 		}
 	}
 }
@@ -365,7 +363,14 @@ void textReset(void) {
 }
 
 
+void textSetBuffered(bool b) {
+	textFlushPending();
+	_outBuffered = b;
+}
+
+
 void textSetColor(byte f, byte b) {
+	textFlushPending();
 	_fcolor = f;
 	_bcolor = b;
 	_ccolor = (f << 4) + b;
@@ -383,10 +388,13 @@ void textSetCursor(byte c) {
 
 
 void textSetDouble(bool x, bool y) {
+	textFlushPending();
 	POKE(VKY_MSTR_CTRL_1, (PEEK(VKY_MSTR_CTRL_1) & 0xf9) | (x << 1) | (y << 2));
 
 	_MAX_COL = x ? 40 : 80;
 	_MAX_ROW = y ? 30 : 60;
+
+	_rowAddr = TEXT_MATRIX + (uint16_t)mathUnsignedMultiply(_MAX_COL, _row);
 }
 
 
@@ -652,89 +660,219 @@ void textCopyBoxFromBuffer(byte x1, byte y1, byte x2, byte y2, const byte *char_
 }
 
 
-void textScrollRowsUp(byte y1, byte y2) {
-	byte     mmu = PEEK(MMU_IO_CTRL);
-	byte     y, x;
+// Shift one plane of a region by one row.  'top' is the address of the
+// region's upper-left cell.  Full-width regions are contiguous and move
+// as a single block.
+static void textShiftPlane(byte *top, byte w, byte h, bool down, byte fill) {
+	byte    *p;
+	byte     n    = h - 1;
+	uint16_t size = (uint16_t)mathUnsignedMultiply(_MAX_COL, n);
 
-	// Scroll text
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-	for (y = y1; y < y2; y++) {
-		uint16_t dst_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y);
-		uint16_t src_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y + 1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + dst_offset + x, PEEK(TEXT_MATRIX + src_offset + x));
+	if (w == _MAX_COL) {
+		if (down) {
+			memmove(top + _MAX_COL, top, size);
+			p = top;
+		} else {
+			memmove(top, top + _MAX_COL, size);
+			p = top + size;
 		}
-	}
-	// Clear last row
-	{
-		uint16_t last_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y2);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + last_offset + x, 32);
+	} else if (down) {
+		p = top + size;
+		while (n--) {
+			memcpy(p, p - _MAX_COL, w);
+			p -= _MAX_COL;
+		}
+	} else {
+		p = top;
+		while (n--) {
+			memcpy(p, p + _MAX_COL, w);
+			p += _MAX_COL;
 		}
 	}
+	memset(p, fill, w);
+}
+
+
+static void textScrollRect(byte x1, byte y1, byte x2, byte y2, bool down) {
+	byte  mmu = PEEK(MMU_IO_CTRL);
+	byte *top;
+	byte  w;
+	byte  h;
+
+	if (x2 >= _MAX_COL) x2 = _MAX_COL - 1;
+	if (y2 >= _MAX_ROW) y2 = _MAX_ROW - 1;
+	if (x1 > x2 || y1 > y2) return;
+
+	w   = x2 - x1 + 1;
+	h   = y2 - y1 + 1;
+	top = (byte *)(TEXT_MATRIX + (uint16_t)mathUnsignedMultiply(_MAX_COL, y1) + x1);
 
-	// Scroll attributes
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
+	textShiftPlane(top, w, h, down, 32);
 	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-	for (y = y1; y < y2; y++) {
-		uint16_t dst_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y);
-		uint16_t src_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y + 1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + dst_offset + x, PEEK(TEXT_MATRIX + src_offset + x));
-		}
-	}
-	// Clear last row attributes
-	{
-		uint16_t last_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y2);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + last_offset + x, _ccolor);
-		}
-	}
+	textShiftPlane(top, w, h, down, _ccolor);
 
 	POKE_MEMMAP(MMU_IO_CTRL, mmu);
 }
 
 
+void textScrollRectUp(byte x1, byte y1, byte x2, byte y2) {
+	textScrollRect(x1, y1, x2, y2, false);
+}
+
+
+void textScrollRectDown(byte x1, byte y1, byte x2, byte y2) {
+	textScrollRect(x1, y1, x2, y2, true);
+}
+
+
+void textScrollRowsUp(byte y1, byte y2) {
+	textScrollRect(0, y1, _MAX_COL - 1, y2, false);
+}
+
+
 void textScrollRowsDown(byte y1, byte y2) {
-	byte     mmu = PEEK(MMU_IO_CTRL);
-	byte     y, x;
+	textScrollRect(0, y1, _MAX_COL - 1, y2, true);
+}
 
-	// Scroll text down
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
-	for (y = y2; y > y1; y--) {
-		uint16_t dst_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y);
-		uint16_t src_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y - 1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + dst_offset + x, PEEK(TEXT_MATRIX + src_offset + x));
-		}
-	}
-	// Clear first row
-	{
-		uint16_t first_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + first_offset + x, 32);
-		}
+
+
+// Shadow buffer state.  A row is clean when _shadowLo > _shadowHi.
+static byte *_shadowChars  = NULL;
+static byte *_shadowColors = NULL;
+static byte  _shadowX;
+static byte  _shadowY;
+static byte  _shadowCols;                   // Visible columns.
+static byte  _shadowStride;                 // Columns per row of the arrays.
+static byte  _shadowRows;
+static bool  _shadowDirty  = false;
+static byte  _shadowLo[TEXT_SHADOW_ROWS];
+static byte  _shadowHi[TEXT_SHADOW_ROWS];
+
+
+void textShadowAttach(byte *chars, byte *colors, byte x, byte y, byte cols, byte rows) {
+	_shadowStride = cols;
+
+	// Only the part that fits on screen is shown.
+	if (x >= _MAX_COL || y >= _MAX_ROW) {
+		cols = 0;
+		rows = 0;
+	} else {
+		if (cols > _MAX_COL - x) cols = _MAX_COL - x;
+		if (rows > _MAX_ROW - y) rows = _MAX_ROW - y;
 	}
+	if (rows > TEXT_SHADOW_ROWS) rows = TEXT_SHADOW_ROWS;
 
-	// Scroll attributes down
-	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
-	for (y = y2; y > y1; y--) {
-		uint16_t dst_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y);
-		uint16_t src_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y - 1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + dst_offset + x, PEEK(TEXT_MATRIX + src_offset + x));
-		}
+	_shadowChars  = chars;
+	_shadowColors = colors;
+	_shadowX      = x;
+	_shadowY      = y;
+	_shadowCols   = cols;
+	_shadowRows   = rows;
+
+	textShadowMarkAll();
+}
+
+
+void textShadowDetach(void) {
+	_shadowChars = NULL;
+	_shadowDirty = false;
+}
+
+
+void textShadowMark(byte x1, byte x2, byte y) {
+	if (y >= _shadowRows || x1 >= _shadowCols) return;
+	if (x2 >= _shadowCols) x2 = _shadowCols - 1;
+
+	if (x1 < _shadowLo[y]) _shadowLo[y] = x1;
+	if (x2 > _shadowHi[y]) _shadowHi[y] = x2;
+	_shadowDirty = true;
+}
+
+
+void textShadowMarkRect(byte x1, byte y1, byte x2, byte y2) {
+	byte y;
+
+	if (y2 >= _shadowRows) y2 = _shadowRows - 1;
+	for (y = y1; y <= y2; y++) textShadowMark(x1, x2, y);
+}
+
+
+void textShadowMarkAll(void) {
+	memset(_shadowLo, 0, _shadowRows);
+	memset(_shadowHi, _shadowCols - 1, _shadowRows);
+	_shadowDirty = true;
+}
+
+
+void textShadowPut(byte x, byte y, char c, byte attr) {
+	uint16_t offset;
+
+	if (x >= _shadowCols || y >= _shadowRows) return;
+
+	offset = (uint16_t)mathUnsignedMultiply(_shadowStride, y) + x;
+	_shadowChars[offset]  = (byte)c;
+	_shadowColors[offset] = attr;
+	textShadowMark(x, x, y);
+}
+
+
+byte textShadowPrintAt(byte x, byte y, const char *s, byte attr) {
+	uint16_t offset;
+	byte     count = 0;
+
+	if (x >= _shadowCols || y >= _shadowRows) return 0;
+
+	offset = (uint16_t)mathUnsignedMultiply(_shadowStride, y) + x;
+	while (s[count] && x + count < _shadowCols) {
+		_shadowChars[offset + count]  = (byte)s[count];
+		_shadowColors[offset + count] = attr;
+		count++;
 	}
-	// Clear first row attributes
-	{
-		uint16_t first_offset = (uint16_t)mathUnsignedMultiply(_MAX_COL, y1);
-		for (x = 0; x < _MAX_COL; x++) {
-			POKE(TEXT_MATRIX + first_offset + x, _ccolor);
-		}
+	if (count) textShadowMark(x, x + count - 1, y);
+
+	return count;
+}
+
+
+// Copy the dirty span of each row from one shadow plane to the matrix
+// currently mapped at TEXT_MATRIX.
+static void textShadowPush(const byte *src) {
+	byte *vram = (byte *)(TEXT_MATRIX + (uint16_t)mathUnsignedMultiply(_MAX_COL, _shadowY) + _shadowX);
+	byte  y;
+	byte  lo;
+
+	for (y = 0; y < _shadowRows; y++) {
+		lo = _shadowLo[y];
+		if (lo <= _shadowHi[y]) memcpy(vram + lo, src + lo, _shadowHi[y] - lo + 1);
+		vram += _MAX_COL;
+		src  += _shadowStride;
 	}
+}
 
+
+bool textFlush(void) {
+	byte mmu;
+
+	if (!_shadowDirty || !_shadowChars) return false;
+
+	mmu = PEEK(MMU_IO_CTRL);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_PAGE_0);
+	while (PEEKW(RAST_ROW_L) < 480)
+		;
+
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_TEXT);
+	textShadowPush(_shadowChars);
+	POKE_MEMMAP(MMU_IO_CTRL, MMU_IO_COLOR);
+	textShadowPush(_shadowColors);
 	POKE_MEMMAP(MMU_IO_CTRL, mmu);
-}
 
+	memset(_shadowLo, 0xff, _shadowRows);
+	memset(_shadowHi, 0, _shadowRows);
+	_shadowDirty = false;
+
+	return true;
+}
 
 void textLoadFont(const byte *data, uint16_t len, bool primary_slot) {
 	byte           mmu   = PEEK(MMU_IO_CTRL);
@@ -37,10 +37,22 @@ typedef enum textColorsE {
 extern colorT textColors[16];
 
 
+// Characters held by textPutChar() while buffering is on.
+#ifndef TEXT_OUT_BUFFER
+#define TEXT_OUT_BUFFER  80
+#endif
+
+// Maximum rows tracked by the shadow text buffer.
+#ifndef TEXT_SHADOW_ROWS
+#define TEXT_SHADOW_ROWS 60
+#endif
+
+
 void textClear(void);
 void textDefineBackgroundColor(byte slot, byte r, byte g, byte b);
 void textDefineForegroundColor(byte slot, byte r, byte g, byte b);
 void textEnableBackgroundColors(bool b);
+void textFlushOutput(void);
 void textGetXY(byte *x, byte *y);
 void textGotoXY(byte x, byte y);
 void textPrint(const char *message);
@@ -55,6 +67,7 @@ void textReadLine(char *buf, byte maxlen);
 char textReadInt(int *result);
 #endif
 void textReset(void);
+void textSetBuffered(bool b);
 void textSetColor(byte f, byte b);
 void textSetCursor(byte c);
 void textSetDouble(bool x, bool y);
@@ -112,6 +125,20 @@ void textCopyBoxToBuffer(byte x1, byte y1, byte x2, byte y2, byte *char_buf, byt
 void textCopyBoxFromBuffer(byte x1, byte y1, byte x2, byte y2, const byte *char_buf, const byte *attr_buf);
 void textScrollRowsUp(byte y1, byte y2);
 void textScrollRowsDown(byte y1, byte y2);
+void textScrollRectUp(byte x1, byte y1, byte x2, byte y2);
+void textScrollRectDown(byte x1, byte y1, byte x2, byte y2);
+
+// Shadow buffer: caller-owned char/attr arrays (cols x rows) shown at x,y.
+// Write through textShadowPut/PrintAt, or write the arrays directly and
+// mark the changed spans.  textFlush() copies only dirty spans at vblank.
+void textShadowAttach(byte *chars, byte *colors, byte x, byte y, byte cols, byte rows);
+void textShadowDetach(void);
+void textShadowMark(byte x1, byte x2, byte y);
+void textShadowMarkRect(byte x1, byte y1, byte x2, byte y2);
+void textShadowMarkAll(void);
+void textShadowPut(byte x, byte y, char c, byte attr);
+byte textShadowPrintAt(byte x, byte y, const char *s, byte attr);
+bool textFlush(void);
 
 // Font loading
 void textLoadFont(const byte *data, uint16_t len, bool primary_slot);
@@ -10,11 +10,262 @@
 #include "f256lib.h"
 
 
-static byte _tileSize[3];
+static byte     _tileSize[3];
+static uint32_t _tileMap[3];
+static uint16_t _tileMapW[3];        // Map width in cells.
+static uint32_t _tileSetAddr[8];
+static bool     _tileSetSquare[8];
+
+// Tiles whose graphics are swapped on a frame schedule.
+typedef struct tileAnimS {
+	uint32_t frames;     // size x size bytes per frame, one after another.
+	byte     set;
+	byte     tile;
+	byte     size;
+	byte     count;      // 0 when the slot is free.
+	byte     delay;      // Ticks per frame.
+	byte     timer;
+	byte     frame;
+} tileAnimT;
+
+static tileAnimT _tileAnim[TILE_ANIM_MAX];
+
+
+// Far address of cell x, y of layer t's map.
+static uint32_t tileCellAddress(byte t, uint16_t x, uint16_t y) {
+	return _tileMap[t] + ((mathUnsignedMultiply(y, _tileMapW[t]) + x) << 1);
+}
+
+
+// Copy frame of an animation over its tile.  With DMA the copy is queued
+// for vertical blank so the tile never changes mid-frame; false if the
+// queue is full, in which case nothing was copied.
+static bool tileAnimCopy(tileAnimT *a, byte frame) {
+	uint16_t bytes = (uint16_t)a->size * a->size;
+	uint32_t src   = a->frames + mathUnsignedMultiply(frame, bytes);
+	uint32_t dest;
+	uint16_t pitch;
+#ifdef WITHOUT_DMA
+	byte     r;
+#endif
+
+	if (_tileSetSquare[a->set]) {
+		pitch = (uint16_t)a->size << 4;
+		dest  = _tileSetAddr[a->set] + mathUnsignedMultiply(a->tile >> 4, mathUnsignedMultiply(pitch, a->size)) + mathUnsignedMultiply(a->tile & 15, a->size);
+#ifndef WITHOUT_DMA
+		return dmaQueue2dCopy(dest, src, a->size, a->size, a->size, pitch, DMA_WAIT_VBL);
+#else
+		for (r = 0; r < a->size; r++) {
+			farToFar(dest, src, a->size);
+			dest += pitch;
+			src  += a->size;
+		}
+		return true;
+#endif
+	}
+
+	dest = _tileSetAddr[a->set] + mathUnsignedMultiply(a->tile, bytes);
+#ifndef WITHOUT_DMA
+	return dmaQueueCopy(dest, src, bytes, DMA_WAIT_VBL);
+#else
+	farToFar(dest, src, bytes);
+	return true;
+#endif
+}
+
+
+// Write count copies of a cell starting at a far address.
+static void tileFillCells(uint32_t dest, uint16_t cell, uint16_t count) {
+	byte      block  = dest / EIGHTK;
+	uint16_t  offset = dest & 0x1FFF;
+	uint16_t *p;
+
+	SWAP_IO_SETUP();
+	POKE_MEMMAP(SWAP_SLOT, block);
+	p = (uint16_t *)(SWAP_ADDR + offset);
+
+	while (count--) {
+		*p++ = cell;
+		offset += 2;
+		if (offset == EIGHTK) {
+			POKE_MEMMAP(SWAP_SLOT, ++block);
+			p      = (uint16_t *)SWAP_ADDR;
+			offset = 0;
+		}
+	}
+
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+
+
+// Copy count map cells (two bytes each) between far addresses, stepping
+// each side by its own stride in bytes.  Cells never straddle a block
+// as long as both addresses are even.
+#ifdef SWAP_SLOT2
+static void tileCopyCells(uint32_t dest, uint16_t destStride, uint32_t src, uint16_t srcStride, uint16_t count) {
+	byte dBlock = 0xff;
+	byte sBlock = 0xff;
+	byte block;
+
+	SWAP_IO_SETUP();
+	SWAP2_SETUP();
+
+	while (count--) {
+		block = dest / EIGHTK;
+		if (block != dBlock) {
+			dBlock = block;
+			POKE_MEMMAP(SWAP_SLOT, block);
+		}
+		block = src / EIGHTK;
+		if (block != sBlock) {
+			sBlock = block;
+			POKE_MEMMAP(SWAP_SLOT2, block);
+		}
+		*(uint16_t *)(SWAP_ADDR + ((uint16_t)dest & 0x1FFF)) = *(uint16_t *)(SWAP_ADDR2 + ((uint16_t)src & 0x1FFF));
+		dest += destStride;
+		src  += srcStride;
+	}
+
+	SWAP2_SHUTDOWN();
+	SWAP_RESTORE_SLOT();
+	SWAP_IO_SHUTDOWN();
+}
+#else
+static void tileCopyCells(uint32_t dest, uint16_t destStride, uint32_t src, uint16_t srcStride, uint16_t count) {
+	while (count--) {
+		FAR_POKEW(dest, FAR_PEEKW(src));
+		dest += destStride;
+		src  += srcStride;
+	}
+}
+#endif
+
+
+// Bring level column col, rows row .. row + mapH - 1, into the ring.
+static void tileStreamColumn(tileStreamT *s, int16_t col, int16_t row) {
+	byte     ringX = (uint16_t)col % s->mapW;
+	byte     ringY = (uint16_t)row % s->mapH;
+	byte     first = s->mapH - ringY;
+	uint16_t pitch = (uint16_t)s->levelW << 1;
+	uint32_t src   = s->level + ((mathUnsignedMultiply(row, s->levelW) + col) << 1);
+	uint32_t dest  = s->map + ((mathUnsignedMultiply(ringY, s->mapW) + ringX) << 1);
+
+	tileCopyCells(dest, s->mapW << 1, src, pitch, first);
+	if (first < s->mapH) tileCopyCells(s->map + (ringX << 1), s->mapW << 1, src + mathUnsignedMultiply(first, pitch), pitch, s->mapH - first);
+}
+
+
+// Bring level row row, columns col .. col + mapW - 1, into the ring.
+static void tileStreamRow(tileStreamT *s, int16_t col, int16_t row) {
+	byte     ringX = (uint16_t)col % s->mapW;
+	byte     first = s->mapW - ringX;
+	uint32_t src   = s->level + ((mathUnsignedMultiply(row, s->levelW) + col) << 1);
+	uint32_t dest  = s->map + (mathUnsignedMultiply((uint16_t)row % s->mapH, s->mapW) << 1);
+
+	farToFar(dest + (ringX << 1), src, first << 1);
+	if (first < s->mapW) farToFar(dest, src + (first << 1), (s->mapW - first) << 1);
+}
+
+
+static void tileWriteScroll(byte t, uint16_t x, uint16_t y) {
+	switch (t) {
+		case 0:
+			POKEW(VKY_TM0_POS_X_L, x);
+			POKEW(VKY_TM0_POS_Y_L, y);
+			break;
+		case 1:
+			POKEW(VKY_TM1_POS_X_L, x);
+			POKEW(VKY_TM1_POS_Y_L, y);
+			break;
+		case 2:
+			POKEW(VKY_TM2_POS_X_L, x);
+			POKEW(VKY_TM2_POS_Y_L, y);
+			break;
+	}
+}
+
+
+// Cycle a tile's graphics through count frames, delay ticks each.  The
+// tileset entry is rewritten once per step, however many cells use it.
+// Returns the animation slot, or 0xff if all TILE_ANIM_MAX are in use.
+byte tileAnimate(byte set, byte tile, byte size, uint32_t frames, byte count, byte delay) {
+	tileAnimT *a;
+	byte       i;
+
+	for (i = 0; i < TILE_ANIM_MAX; i++) {
+		a = &_tileAnim[i];
+		if (a->count) continue;
+		a->frames = frames;
+		a->set    = set;
+		a->tile   = tile;
+		a->size   = size;
+		a->count  = count;
+		a->delay  = delay ? delay : 1;
+		a->timer  = a->delay;
+		a->frame  = 0;
+		if (!tileAnimCopy(a, 0)) {
+			// Queue full: show frame 0 from the next tick instead.
+			a->frame = count - 1;
+			a->timer = 1;
+		}
+		return i;
+	}
+
+	return 0xff;
+}
+
+
+void tileAnimateStop(byte slot) {
+	_tileAnim[slot].count = 0;
+}
+
+
+// Advance every animation by one tick; call once per frame.  A step
+// whose copy can't be queued is retried on the next tick, so frames
+// always land in order.  The queued copies start from dmaService().
+void tileAnimateTick(void) {
+	tileAnimT *a;
+	byte       i;
+	byte       next;
+
+	for (i = 0; i < TILE_ANIM_MAX; i++) {
+		a = &_tileAnim[i];
+		if (!a->count || --a->timer) continue;
+		next = a->frame + 1;
+		if (next == a->count) next = 0;
+		if (tileAnimCopy(a, next)) {
+			a->frame = next;
+			a->timer = a->delay;
+		} else {
+			a->timer = 1;
+		}
+	}
+}
+
+
+// Copy a w x h block of cells from far memory, rows srcW cells apart.
+void tileCopyRect(byte t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t src, uint16_t srcW) {
+	uint32_t dest  = tileCellAddress(t, x, y);
+	uint16_t pitch = _tileMapW[t] << 1;
+
+	if (!w || !h) return;
+#ifndef WITHOUT_DMA
+	dmaQueue2dCopy(dest, src, w << 1, h, srcW << 1, pitch, DMA_SYNC);
+#else
+	while (h--) {
+		farToFar(dest, src, w << 1);
+		dest += pitch;
+		src  += srcW << 1;
+	}
+#endif
+}
 
 
 void tileDefineTileMap(byte t, uint32_t address, byte tileSize, uint16_t mapSizeX, uint16_t mapSizeY) {
 	_tileSize[t] = tileSize;
+	_tileMap[t]  = address;
+	_tileMapW[t] = mapSizeX;
 	switch (t) {
 		case 0:
 			POKEA(VKY_TM0_ADDR_L, address);
@@ -38,6 +289,9 @@ void tileDefineTileMap(byte t, uint32_t address, byte tileSize, uint16_t mapSize
 
 
 void tileDefineTileSet(byte t, uint32_t address, bool square) {
+	_tileSetAddr[t]   = address;
+	_tileSetSquare[t] = square;
+
 	switch (t) {
 		case 0:
 			POKEA(VKY_TS0_ADDR_L, address);
@@ -75,27 +329,33 @@ void tileDefineTileSet(byte t, uint32_t address, bool square) {
 }
 
 
-void tileSetScroll(byte t, byte xPixels, uint16_t xTiles, byte yPixels, uint16_t yTiles) {
-	uint16_t scrollX = (xTiles << 4) + xPixels;
-	uint16_t scrollY = (yTiles << 4) + yPixels;
+// Cells hold the tile number in the low byte and tileset and CLUT
+// in the high byte.
+void tileFillRect(byte t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t cell) {
+	uint32_t dest  = tileCellAddress(t, x, y);
+	uint16_t pitch = _tileMapW[t] << 1;
 
-	switch (t) {
-		case 0:
-			POKEW(VKY_TM0_POS_X_L, scrollX);
-			POKEW(VKY_TM0_POS_Y_L, scrollY);
-			break;
-		case 1:
-			POKEW(VKY_TM1_POS_X_L, scrollX);
-			POKEW(VKY_TM1_POS_Y_L, scrollY);
-			break;
-		case 2:
-			POKEW(VKY_TM2_POS_X_L, scrollX);
-			POKEW(VKY_TM2_POS_Y_L, scrollY);
-			break;
+	if (!w) return;
+	while (h--) {
+		tileFillCells(dest, cell, w);
+		dest += pitch;
 	}
 }
 
 
+void tileSetCell(byte t, uint16_t x, uint16_t y, uint16_t cell) {
+	FAR_POKEW(tileCellAddress(t, x, y), cell);
+}
+
+
+// Scroll registers count pixels, so tiles scale by the layer's tile size.
+void tileSetScroll(byte t, byte xPixels, uint16_t xTiles, byte yPixels, uint16_t yTiles) {
+	byte shift = _tileSize[t] == 8 ? 3 : 4;
+
+	tileWriteScroll(t, (xTiles << shift) + xPixels, (yTiles << shift) + yPixels);
+}
+
+
 void tileSetVisible(byte t, bool v) {
 	switch (t) {
 		case 0:
@@ -111,7 +371,68 @@ void tileSetVisible(byte t, bool v) {
 }
 
 
+// Point layer t at a mapW x mapH ring map at map and fill it from a
+// levelW x levelH level map at level, both in far memory.  The ring must
+// be at least one cell wider and taller than the screen.
+void tileStreamInit(tileStreamT *s, byte t, uint32_t level, uint16_t levelW, uint16_t levelH, uint32_t map, byte mapW, byte mapH) {
+	byte r;
+
+	s->t      = t;
+	s->level  = level;
+	s->levelW = levelW;
+	s->levelH = levelH;
+	s->map    = map;
+	s->mapW   = mapW;
+	s->mapH   = mapH;
+	s->shift  = _tileSize[t] == 8 ? 3 : 4;
+	s->col    = 0;
+	s->row    = 0;
+
+	tileDefineTileMap(t, map, _tileSize[t], mapW, mapH);
+	for (r = 0; r < mapH; r++) tileStreamRow(s, 0, r);
+}
+
+
+// Scroll the camera to pixel x, y of the level.  Only the columns and rows
+// that came into view are copied, so the cost follows the distance moved.
+// The camera must keep the ring inside the level.
+void tileStreamMove(tileStreamT *s, uint16_t x, uint16_t y) {
+	int16_t col = x >> s->shift;
+	int16_t row = y >> s->shift;
+	byte    r;
+
+	if (col - s->col >= s->mapW || s->col - col >= s->mapW || row - s->row >= s->mapH || s->row - row >= s->mapH) {
+		// Jumped a whole ring: refill it.
+		s->col = col;
+		s->row = row;
+		for (r = 0; r < s->mapH; r++) tileStreamRow(s, col, row + r);
+	} else {
+		while (s->col < col) {
+			tileStreamColumn(s, s->col + s->mapW, s->row);
+			s->col++;
+		}
+		while (s->col > col) {
+			s->col--;
+			tileStreamColumn(s, s->col, s->row);
+		}
+		while (s->row < row) {
+			tileStreamRow(s, s->col, s->row + s->mapH);
+			s->row++;
+		}
+		while (s->row > row) {
+			s->row--;
+			tileStreamRow(s, s->col, s->row);
+		}
+	}
+
+	tileWriteScroll(s->t, x % ((uint16_t)s->mapW << s->shift), y % ((uint16_t)s->mapH << s->shift));
+}
+
+
 void tileReset(void) {
+	byte i;
+
+	for (i = 0; i < TILE_ANIM_MAX; i++) _tileAnim[i].count = 0;
 	_tileSize[0] = 8;
 	_tileSize[1] = 8;
 	_tileSize[2] = 8;
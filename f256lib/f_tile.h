@@ -12,10 +12,39 @@
 #include "f256lib.h"
 
 
+#ifndef TILE_ANIM_MAX
+#define TILE_ANIM_MAX  8   // Animated tiles.
+#endif
+
+
+// A level larger than the hardware map, streamed through a ring map that
+// wraps at its edges.  Both hold two bytes per cell.
+typedef struct tileStreamS {
+	uint32_t level;
+	uint16_t levelW;
+	uint16_t levelH;
+	uint32_t map;
+	byte     mapW;
+	byte     mapH;
+	byte     t;
+	byte     shift;       // Log2 of the tile size.
+	int16_t  col;         // Level cell at the ring's top left.
+	int16_t  row;
+} tileStreamT;
+
+
+byte tileAnimate(byte set, byte tile, byte size, uint32_t frames, byte count, byte delay);
+void tileAnimateStop(byte slot);
+void tileAnimateTick(void);
+void tileCopyRect(byte t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t src, uint16_t srcW);
 void tileDefineTileMap(byte t, uint32_t address, byte tileSize, uint16_t mapSizeX, uint16_t mapSizeY);
 void tileDefineTileSet(byte t, uint32_t address, bool square);
+void tileFillRect(byte t, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t cell);
+void tileSetCell(byte t, uint16_t x, uint16_t y, uint16_t cell);
 void tileSetScroll(byte t, byte xPixels, uint16_t xTiles, byte yPixels, uint16_t yTiles);
 void tileSetVisible(byte t, bool v);
+void tileStreamInit(tileStreamT *s, byte t, uint32_t level, uint16_t levelW, uint16_t levelH, uint32_t map, byte mapW, byte mapH);
+void tileStreamMove(tileStreamT *s, uint16_t x, uint16_t y);
 void tileReset(void);
 
 
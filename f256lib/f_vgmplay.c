@@ -46,10 +46,7 @@ void vgmCopyToRAM(FILE *theVGMfile) {
 	while (exitFlag) {
 		bytesRead = fileRead(buffer, sizeof(uint8_t), 255, theVGMfile);
 		if (bytesRead != 255) exitFlag = false;
-		uint8_t i;
-		for (i = 0; i < bytesRead; i++) {
-			FAR_POKE(VGM_BODY + (uint32_t)i + (uint32_t)soFar, buffer[i]);
-		}
+		farMemcpy(VGM_BODY + soFar, buffer, bytesRead);
 		soFar += bytesRead;
 	}
 }
@@ -181,7 +178,7 @@ int8_t vgmPlayback(FILE *theVGMfile, bool iRT, bool pReq) {
 				lo = FAR_PEEK(vgmNeedle++);
 				hi = FAR_PEEK(vgmNeedle++);
 				vgmSamplesSoFar += (uint32_t)lo | ((uint32_t)hi) << 8;
-				vgmTooBigWait = (((uint32_t)hi << 8) | (uint32_t)lo) * (uint32_t)0x23A;
+				vgmTooBigWait = mathUnsignedMultiply(((uint16_t)hi << 8) | lo, 0x23A);
 				if (vgmTooBigWait > 0x00FFFFFF) {
 					timer0Set(0x00FFFFFF);
 					vgmTooBigWait -= 0x00FFFFFF;
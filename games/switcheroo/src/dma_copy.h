@@ -1,3 +0,0 @@
-#include <stdint.h>
-
-void dma2dCopy(uint32_t dest, uint32_t src, uint16_t width, uint16_t height, uint16_t source_stride, uint16_t dest_stride);#pragma compile("dma_copy.c")
@@ -3,7 +3,6 @@
 #include "video.h"
 #include "text_display.h"
 #include "mouse_pointer.h"
-#include "dma_copy.h"
 #include "playsid.h"
 #include "overlay_config.h"
 
@@ -7,7 +7,6 @@
 #include "video.h"
 #include "text_display.h"
 #include "sram_assets.h"
-#include "dma_copy.h"
 #include "overlay_config.h"
 
 // Function declarations 
@@ -0,0 +1,232 @@
+#include "f256lib.h"
+
+// Checks the sort-and-sweep broad phase against a brute force pairwise
+// test over random scenes, and the pixel masks against a per-pixel test.
+
+#define SCENES   40
+#define OBJECTS  64
+#define MAX_PAIRS 256
+#define MASK_BASE 0x24000UL   // Scratch far memory for two masks.
+
+static byte         failures;
+static collidePairT pairs[MAX_PAIRS];
+static int16_t      xs[OBJECTS], ys[OBJECTS];
+static byte         ws[OBJECTS], hs[OBJECTS], layers[OBJECTS], masks[OBJECTS];
+static bool         on[OBJECTS];
+static byte         seen[OBJECTS][OBJECTS / 8];
+
+static const byte sizes[] = { 8, 16, 24, 32 };
+static uint32_t   rowsA[32], rowsB[32];
+
+static void report(const char *name, bool ok)
+{
+	textPrint(name);
+	if (ok)
+		textPrint(": ok\n");
+	else
+	{
+		textPrint(": FAIL\n");
+		failures++;
+	}
+}
+
+static bool brute(byte a, byte b)
+{
+	if (!on[a] || !on[b])
+		return false;
+	if (!(masks[a] & layers[b]) && !(masks[b] & layers[a]))
+		return false;
+	return xs[b] < xs[a] + ws[a] && xs[a] < xs[b] + ws[b] &&
+		ys[b] < ys[a] + hs[a] && ys[a] < ys[b] + hs[b];
+}
+
+static void scene(byte spread)
+{
+	byte i;
+
+	for (i = 0; i < OBJECTS; i++)
+	{
+		xs[i] = (int16_t)(randomRead() % spread) - 32;
+		ys[i] = (int16_t)(randomRead() % spread) - 32;
+		ws[i] = sizes[randomRead() & 3];
+		hs[i] = sizes[randomRead() & 3];
+		layers[i] = 1 << (randomRead() & 3);
+		masks[i] = randomRead() & 15;
+		on[i] = (randomRead() & 7) != 0;
+		collideDefine(i, ws[i], hs[i], layers[i], masks[i]);
+		collideMove(i, xs[i], ys[i]);
+		collideEnable(i, on[i]);
+	}
+}
+
+static bool check_scene(void)
+{
+	uint16_t found, expect = 0, k;
+	byte     i, j, a, b;
+
+	for (i = 0; i < OBJECTS; i++)
+		for (j = 0; j < OBJECTS / 8; j++)
+			seen[i][j] = 0;
+
+	found = collideFind(pairs, MAX_PAIRS);
+	if (found > MAX_PAIRS)
+		return false;
+
+	for (k = 0; k < found; k++)
+	{
+		a = pairs[k].a < pairs[k].b ? pairs[k].a : pairs[k].b;
+		b = pairs[k].a ^ pairs[k].b ^ a;
+		if (a == b || !brute(a, b) || (seen[a][b >> 3] & (1 << (b & 7))))
+			return false;
+		seen[a][b >> 3] |= 1 << (b & 7);
+	}
+
+	for (i = 0; i < OBJECTS; i++)
+		for (j = i + 1; j < OBJECTS; j++)
+			if (brute(i, j))
+			{
+				expect++;
+				if (collideOverlap(i, j) == false)
+					return false;
+			}
+
+	return found == expect;
+}
+
+static bool test_random(void)
+{
+	byte n;
+
+	for (n = 0; n < SCENES; n++)
+	{
+		scene(n & 1 ? 200 : 120);
+		if (!check_scene())
+			return false;
+		if ((n & 7) == 0)
+			textPrint(".");
+	}
+	return true;
+}
+
+// Small moves between calls keep the sort order mostly intact.
+static bool test_coherent(void)
+{
+	byte n, i;
+
+	scene(160);
+	for (n = 0; n < SCENES; n++)
+	{
+		for (i = 0; i < OBJECTS; i++)
+		{
+			xs[i] += (int16_t)(randomRead() % 9) - 4;
+			ys[i] += (int16_t)(randomRead() % 9) - 4;
+			collideMove(i, xs[i], ys[i]);
+		}
+		if (!check_scene())
+			return false;
+	}
+	return true;
+}
+
+static bool test_truncate(void)
+{
+	byte i;
+
+	for (i = 0; i < OBJECTS; i++)
+	{
+		collideDefine(i, 32, 32, 1, 1);
+		collideMove(i, i & 7, i >> 3);
+		collideEnable(i, true);
+	}
+	return collideFind(pairs, 10) == (uint16_t)OBJECTS * (OBJECTS - 1) / 2;
+}
+
+static bool pixel(uint32_t *rows, int16_t x, int16_t y)
+{
+	return (rows[y] & (0x80000000UL >> x)) != 0;
+}
+
+// Object 0 is masked; object 1 is masked or a solid box.
+static bool slow_pixels(bool masked)
+{
+	int16_t x, y;
+
+	for (y = 0; y < 32; y++)
+		for (x = 0; x < 32; x++)
+		{
+			int16_t bx = xs[0] + x - xs[1], by = ys[0] + y - ys[1];
+			if (!pixel(rowsA, x, y) || bx < 0 || by < 0 || bx >= ws[1] || by >= hs[1])
+				continue;
+			if (!masked || pixel(rowsB, bx, by))
+				return true;
+		}
+	return false;
+}
+
+static bool test_pixels(void)
+{
+	uint16_t n;
+	byte     i;
+
+	for (i = 2; i < COLLIDE_MAX; i++)
+		collideEnable(i, false);
+
+	for (n = 0; n < 400; n++)
+	{
+		bool masked = n & 1;
+
+		// Sparse random blobs so near misses are common.
+		for (i = 0; i < 32; i++)
+		{
+			rowsA[i] = (i & 3) ? 0 : ((uint32_t)randomRead() << 16 | randomRead()) & 0x0f0f0f0fUL;
+			rowsB[i] = (i % 5) ? 0 : ((uint32_t)randomRead() << 16 | randomRead()) & 0xf0f0f0f0UL;
+		}
+		farMemcpy(MASK_BASE, rowsA, sizeof(rowsA));
+		farMemcpy(MASK_BASE + sizeof(rowsA), rowsB, sizeof(rowsB));
+
+		xs[0] = 100; ys[0] = 100; ws[0] = 32; hs[0] = 32;
+		xs[1] = 100 + (int16_t)(randomRead() % 80) - 40;
+		ys[1] = 100 + (int16_t)(randomRead() % 80) - 40;
+		ws[1] = masked ? 32 : 8 + (randomRead() % 40);
+		hs[1] = masked ? 32 : 8 + (randomRead() % 40);
+
+		for (i = 0; i < 2; i++)
+		{
+			collideDefine(i, ws[i], hs[i], 1, 1);
+			collideMove(i, xs[i], ys[i]);
+			collideEnable(i, true);
+		}
+		collideSetMask(0, MASK_BASE);
+		collideSetMask(1, masked ? MASK_BASE + sizeof(rowsA) : 0);
+
+		if (collidePixels(0, 1) != slow_pixels(masked) || collidePixels(1, 0) != slow_pixels(masked))
+			return false;
+	}
+	collideSetMask(0, 0);
+	collideSetMask(1, 0);
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	textClear();
+	textPrint("=== COLLIDE TEST ===\n\n");
+
+	randomSeed(0xc011);
+	failures = 0;
+	textPrint("random scenes ");
+	report("", test_random());
+	report("coherent motion", test_coherent());
+	report("pair count past max", test_truncate());
+	report("pixel masks", test_pixels());
+
+	textPrint("\n");
+	textPrint(failures ? "FAILED" : "All tests passed.");
+	textPrint("\nPress Enter to exit.\n");
+	kernelWaitKey();
+
+	return 0;
+}
@@ -0,0 +1,112 @@
+#include "f256lib.h"
+
+// Scratch area in far memory, straddling the 0x24000 block boundary
+#define TEST_BASE  0x23F00UL
+#define TEST_LEN   600
+
+static byte near_buf[TEST_LEN];
+static byte failures;
+
+// Pattern byte for offset i, varied by seed so each pass writes new data
+static byte pattern(uint16_t i, byte seed)
+{
+	return (byte)(i * 7 + seed);
+}
+
+static void report(const char *name, bool ok)
+{
+	textPrint(name);
+	if (ok)
+		textPrint(": ok\n");
+	else
+	{
+		textPrint(": FAIL\n");
+		failures++;
+	}
+}
+
+// near -> far, verified with FAR_PEEK
+static bool test_copy_to_far(void)
+{
+	uint16_t i;
+
+	for (i = 0; i < TEST_LEN; i++)
+		near_buf[i] = pattern(i, 1);
+	farMemcpy(TEST_BASE, near_buf, TEST_LEN);
+
+	for (i = 0; i < TEST_LEN; i++)
+		if (FAR_PEEK(TEST_BASE + i) != pattern(i, 1))
+			return false;
+	return true;
+}
+
+// far -> near, source written with FAR_POKE
+static bool test_copy_to_near(void)
+{
+	uint16_t i;
+
+	for (i = 0; i < TEST_LEN; i++)
+		FAR_POKE(TEST_BASE + i, pattern(i, 2));
+	farMemcpyNear(near_buf, TEST_BASE, TEST_LEN);
+
+	for (i = 0; i < TEST_LEN; i++)
+		if (near_buf[i] != pattern(i, 2))
+			return false;
+	return true;
+}
+
+// fill, including the bytes on either side that must stay untouched
+static bool test_fill(void)
+{
+	uint16_t i;
+
+	FAR_POKE(TEST_BASE - 1, 0x11);
+	FAR_POKE(TEST_BASE + TEST_LEN, 0x22);
+	farMemset(TEST_BASE, 0xA5, TEST_LEN);
+
+	if (FAR_PEEK(TEST_BASE - 1) != 0x11 || FAR_PEEK(TEST_BASE + TEST_LEN) != 0x22)
+		return false;
+	for (i = 0; i < TEST_LEN; i++)
+		if (FAR_PEEK(TEST_BASE + i) != 0xA5)
+			return false;
+	return true;
+}
+
+// far -> far with source and destination at different block offsets
+static bool test_far_to_far(void)
+{
+	uint32_t dest = TEST_BASE + 0x4123;
+	uint16_t i;
+
+	for (i = 0; i < TEST_LEN; i++)
+		near_buf[i] = pattern(i, 3);
+	farMemcpy(TEST_BASE, near_buf, TEST_LEN);
+	farToFar(dest, TEST_BASE, TEST_LEN);
+
+	for (i = 0; i < TEST_LEN; i++)
+		if (FAR_PEEK(dest + i) != pattern(i, 3))
+			return false;
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	textClear();
+	textPrint("=== FAR MEMORY TEST ===\n\n");
+
+	failures = 0;
+	report("farMemcpy", test_copy_to_far());
+	report("farMemcpyNear", test_copy_to_near());
+	report("farMemset", test_fill());
+	report("farToFar", test_far_to_far());
+
+	textPrint("\n");
+	textPrint(failures ? "FAILED" : "All tests passed.");
+	textPrint("\nPress Enter to exit.\n");
+	kernelWaitKey();
+
+	return 0;
+}
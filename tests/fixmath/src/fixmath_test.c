@@ -0,0 +1,310 @@
+#include "f256lib.h"
+#include <math.h>
+
+// Accuracy checks and timings for the fixed-point math layer.  Results
+// are compared against exact integer references where one exists and
+// against float otherwise.
+
+#define SAMPLES    2000
+#define BENCH_RUNS 64
+#define TWO_PI     6.28318531
+
+static byte failures;
+
+// Timer 0 counts the 25.175 MHz dot clock, about four per CPU cycle.
+static void bench_start(void)
+{
+	POKE(TM0_CTRL, TM_CTRL_CLEAR);
+	POKE(TM0_CTRL, TM_CTRL_UP_DOWN | TM_CTRL_ENABLE);
+}
+
+static uint16_t bench_stop(void)
+{
+	uint32_t ticks;
+
+	POKE(TM0_CTRL, 0);
+	ticks = PEEK(TM0_VALUE_L) | ((uint16_t)PEEK(TM0_VALUE_M) << 8) | ((uint32_t)PEEK(TM0_VALUE_H) << 16);
+	return (uint16_t)(ticks / (4 * BENCH_RUNS));
+}
+
+static void report(const char *name, bool ok, int32_t worst, uint16_t cycles)
+{
+	textPrint(name);
+	textPrint(ok ? ": ok   " : ": FAIL ");
+	textPrint("worst ");
+	textPrintInt(worst);
+	textPrint("  cycles ");
+	textPrintUInt(cycles);
+	textPrint("\n");
+	if (!ok)
+		failures++;
+}
+
+static int32_t rand32(void)
+{
+	return ((int32_t)randomRead() << 16) | randomRead();
+}
+
+static void test_fix8_multiply(void)
+{
+	volatile fix8T sink;
+	int32_t  worst = 0;
+	uint16_t i, cycles;
+	fix8T    a, b;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		a = randomRead();
+		b = (int16_t)randomRead() >> 4;
+		if (mathFix8Multiply(a, b) != (fix8T)(((int32_t)a * b) >> 8))
+			worst++;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathFix8Multiply(i, FIX8(1.5));
+	cycles = bench_stop();
+	report("fix8 mul ", worst == 0, worst, cycles);
+}
+
+static void test_fix8_division(void)
+{
+	volatile fix8T sink;
+	int32_t  worst = 0;
+	int32_t  ref;
+	uint16_t i, cycles;
+	fix8T    a, b;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		a = randomRead();
+		b = randomRead();
+		if (b == 0)
+			continue;
+		ref = ((int32_t)a << 8) / b;
+		if (ref > 0x7fff || ref < -0x7fff)
+			continue;
+		if (mathFix8Division(a, b) != (fix8T)ref)
+			worst++;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathFix8Division(FIX8(100.0), i + 300);
+	cycles = bench_stop();
+	report("fix8 div ", worst == 0, worst, cycles);
+}
+
+static void test_fix16_multiply(void)
+{
+	volatile fix16T sink;
+	int32_t  worst = 0;
+	int32_t  err;
+	uint16_t i, cycles;
+	fix16T   a, b, r;
+	float    ref;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		// Keep the product inside 16.16 range.
+		a = rand32() >> 8;
+		b = rand32() >> 8;
+		r = mathFix16Multiply(a, b);
+		ref = (float)a * (float)b / 65536.0;
+		err = (int32_t)(r - ref);
+		if (err < 0)
+			err = -err;
+		// Float carries 24 bits, so allow its own rounding on top.
+		err -= (int32_t)(fabs(ref) / 4194304.0);
+		if (err > worst)
+			worst = err;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathFix16Multiply(FIX16(3.25), (fix16T)i << 12);
+	cycles = bench_stop();
+	report("fix16 mul", worst <= 1, worst, cycles);
+}
+
+static void test_fix16_division(void)
+{
+	volatile fix16T sink;
+	int32_t  worst = 0;
+	int32_t  err;
+	uint16_t i, cycles;
+	fix16T   a, b, r;
+	float    ref;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		a = rand32() >> 4;
+		b = rand32() >> (randomRead() & 15);
+		if (b == 0)
+			continue;
+		ref = (float)a / (float)b * 65536.0;
+		if (fabs(ref) > 2000000000.0)
+			continue;
+		r = mathFix16Division(a, b);
+		err = (int32_t)(r - ref);
+		if (err < 0)
+			err = -err;
+		// Divisor is cut to 16 significant bits: 2^-15 relative.
+		err -= (int32_t)(fabs(ref) / 32768.0) + (int32_t)(fabs(ref) / 4194304.0);
+		if (err > worst)
+			worst = err;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathFix16Division(FIX16(1000.0), ((fix16T)i << 10) + 1);
+	cycles = bench_stop();
+	report("fix16 div", worst <= 1, worst, cycles);
+}
+
+static void test_sin_cos(void)
+{
+	volatile fix16T sink;
+	int32_t  worst = 0;
+	int32_t  err;
+	uint16_t i, cycles;
+	uint16_t angle;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		angle = randomRead();
+		err = mathFix16Sin(angle) - (int32_t)(sin(angle * (TWO_PI / 65536.0)) * 65536.0);
+		if (err < 0)
+			err = -err;
+		if (err > worst)
+			worst = err;
+		err = mathFix16Cos(angle) - (int32_t)(cos(angle * (TWO_PI / 65536.0)) * 65536.0);
+		if (err < 0)
+			err = -err;
+		if (err > worst)
+			worst = err;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathFix16Sin(i * 997);
+	cycles = bench_stop();
+	report("sin/cos  ", worst <= 4, worst, cycles);
+}
+
+static void test_atan2(void)
+{
+	volatile uint16_t sink;
+	int32_t  worst = 0;
+	int32_t  err;
+	uint16_t i, cycles;
+	int16_t  x, y;
+	uint16_t ref;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		x = randomRead();
+		y = randomRead();
+		if (x == 0 && y == 0)
+			continue;
+		ref = (uint16_t)(int32_t)(atan2(y, x) * (65536.0 / TWO_PI));
+		err = (int16_t)(mathAtan2(y, x) - ref);
+		if (err < 0)
+			err = -err;
+		if (err > worst)
+			worst = err;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathAtan2(i * 37, 1000 - i);
+	cycles = bench_stop();
+	report("atan2    ", worst <= 8, worst, cycles);
+}
+
+static void test_sqrt(void)
+{
+	volatile uint16_t sink;
+	int32_t  worst = 0;
+	uint16_t i, cycles;
+	uint32_t a;
+	uint16_t r;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		a = rand32();
+		r = mathSqrt(a);
+		if (mathUnsignedMultiply(r, r) > a ||
+			(r != 0xffff && mathUnsignedMultiply(r + 1, r + 1) <= a))
+			worst++;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathSqrt((uint32_t)i * 65521);
+	cycles = bench_stop();
+	report("sqrt     ", worst == 0, worst, cycles);
+}
+
+static void test_distance(void)
+{
+	volatile uint16_t sink;
+	int32_t  worst = 0;
+	int32_t  err;
+	uint16_t i, exact_cycles, fast_cycles;
+	int16_t  dx, dy;
+	uint16_t d;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		dx = (int16_t)randomRead() >> 1;
+		dy = (int16_t)randomRead() >> 1;
+		d = mathDistance(dx, dy);
+		// Error of the fast form in tenths of a percent.
+		err = ((int32_t)mathDistanceFast(dx, dy) - d) * 1000 / (d + 1);
+		if (err < 0)
+			err = -err;
+		if (err > worst)
+			worst = err;
+	}
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathDistance(i * 91, 500 - i);
+	exact_cycles = bench_stop();
+
+	bench_start();
+	for (i = 0; i < BENCH_RUNS; i++)
+		sink = mathDistanceFast(i * 91, 500 - i);
+	fast_cycles = bench_stop();
+
+	report("distance ", true, 0, exact_cycles);
+	report("dist fast", worst <= 40, worst, fast_cycles);
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	textClear();
+	textPrint("=== FIXED POINT MATH TEST ===\n\n");
+
+	randomSeed(0x1234);
+	failures = 0;
+	test_fix8_multiply();
+	test_fix8_division();
+	test_fix16_multiply();
+	test_fix16_division();
+	test_sin_cos();
+	test_atan2();
+	test_sqrt();
+	test_distance();
+
+	textPrint("\n");
+	textPrint(failures ? "FAILED" : "All tests passed.");
+	textPrint("\nPress Enter to exit.\n");
+	kernelWaitKey();
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+#include "f256lib.h"
+
+// Checks the 32-bit composite multiply and divide against the compiler's
+// software arithmetic.
+
+#define SAMPLES 4000
+
+static byte failures;
+
+static const uint32_t edges[] = {
+	0, 1, 2, 9, 10, 255, 256, 257, 0x7fff, 0x8000, 0xffff, 0x10000, 0x10001,
+	0x123456, 0xffffff, 0x1000000, 0x7fffffff, 0x80000000, 0xfffffffe, 0xffffffff
+};
+
+#define EDGE_COUNT (sizeof(edges) / sizeof(edges[0]))
+
+static void report(const char *name, bool ok)
+{
+	textPrint(name);
+	if (ok)
+		textPrint(": ok\n");
+	else
+	{
+		textPrint(": FAIL\n");
+		failures++;
+	}
+}
+
+static uint32_t rand32(void)
+{
+	return ((uint32_t)randomRead() << 16) | randomRead();
+}
+
+static bool check_divide(uint32_t a, uint16_t b)
+{
+	uint16_t r;
+
+	if (mathUnsignedDivisionRemainder32(a, b, &r) != a / b)
+		return false;
+	return r == a % b;
+}
+
+static bool test_multiply(void)
+{
+	uint32_t a, b;
+	byte     i, j;
+	uint16_t n;
+
+	for (i = 0; i < EDGE_COUNT; i++)
+		for (j = 0; j < EDGE_COUNT; j++)
+			if (mathUnsignedMultiply32(edges[i], edges[j]) != edges[i] * edges[j])
+				return false;
+
+	for (n = 0; n < SAMPLES; n++)
+	{
+		a = rand32();
+		b = rand32() >> (n & 31);
+		if (mathUnsignedMultiply32(a, b) != a * b)
+			return false;
+	}
+	return true;
+}
+
+static bool test_signed_multiply(void)
+{
+	int32_t  a, b;
+	uint16_t n;
+
+	for (n = 0; n < SAMPLES; n++)
+	{
+		a = (int32_t)rand32() >> (n & 15);
+		b = (int32_t)rand32() >> (n >> 4 & 15);
+		if (mathSignedMultiply32(a, b) != a * b)
+			return false;
+	}
+	return true;
+}
+
+// Every divisor against the numerators that stress the quotient
+// estimate hardest.
+static bool test_divide_all_divisors(void)
+{
+	uint16_t b = 0;
+
+	do
+	{
+		b++;
+		if (!check_divide(0xffffffff, b) || !check_divide(0x80000000, b) ||
+			!check_divide((uint32_t)b * b - 1, b))
+			return false;
+		if ((b & 0x0fff) == 0)
+			textPrint(".");
+	} while (b != 0xffff);
+	return true;
+}
+
+static bool test_divide_random(void)
+{
+	byte     i;
+	uint16_t n;
+
+	for (i = 0; i < EDGE_COUNT; i++)
+		if (edges[i] && edges[i] <= 0xffff)
+			if (!check_divide(0xffffffff, (uint16_t)edges[i]) || !check_divide(edges[i], (uint16_t)edges[i]))
+				return false;
+
+	for (n = 0; n < SAMPLES; n++)
+	{
+		uint16_t b = randomRead() >> (n & 15);
+		if (b && !check_divide(rand32(), b))
+			return false;
+	}
+	return true;
+}
+
+static bool test_signed_divide(void)
+{
+	int32_t  a;
+	int16_t  b;
+	uint16_t n;
+
+	for (n = 0; n < SAMPLES; n++)
+	{
+		a = (int32_t)rand32();
+		b = (int16_t)randomRead() >> (n & 15);
+		if (b && mathSignedDivision32(a, b) != a / b)
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	textClear();
+	textPrint("=== 32-BIT MATH TEST ===\n\n");
+
+	randomSeed(0x5eed);
+	failures = 0;
+	report("mathUnsignedMultiply32", test_multiply());
+	report("mathSignedMultiply32", test_signed_multiply());
+	report("mathUnsignedDivision32 random", test_divide_random());
+	report("mathSignedDivision32", test_signed_divide());
+	textPrint("all divisors ");
+	report("", test_divide_all_divisors());
+
+	textPrint("\n");
+	textPrint(failures ? "FAILED" : "All tests passed.");
+	textPrint("\nPress Enter to exit.\n");
+	kernelWaitKey();
+
+	return 0;
+}
@@ -1,24 +1,46 @@
 // 1010 RasterLine - Raster line color effect
 // Ported from OscarTutorials to F256K using f256lib
 //
-// Changes border color per-frame to show raster timing.
+// Splits the border into color bands with the raster line scheduler,
+// run from the line interrupt.  Build with -dRASTER_POLL to poll it from
+// the main loop instead.
 
 #include "f256lib.h"
 
+static const rasterWriteT red[] = {
+	{ VKY_BRDR_COL_R, 0x88 }, { VKY_BRDR_COL_G, 0x39 }, { VKY_BRDR_COL_B, 0x32 }
+};
+static const rasterWriteT yellow[] = {
+	{ VKY_BRDR_COL_R, 0xBF }, { VKY_BRDR_COL_G, 0xCE }, { VKY_BRDR_COL_B, 0x72 }
+};
+static const rasterWriteT blue[] = {
+	{ VKY_BRDR_COL_R, 0x40 }, { VKY_BRDR_COL_G, 0x31 }, { VKY_BRDR_COL_B, 0x8D }
+};
+
+static const rasterEntryT bands[] = {
+	{   0, MMU_IO_PAGE_0, red,    3, NULL },
+	{ 160, MMU_IO_PAGE_0, yellow, 3, NULL },
+	{ 320, MMU_IO_PAGE_0, blue,   3, NULL }
+};
+
 int main(int argc, char *argv[])
 {
 	textClear();
 	textPrint("RASTER LINE EFFECT\nPRESS ANY KEY TO STOP\n");
 
-	byte c = 0;
+	rasterSchedule(bands, 3);
+#ifdef RASTER_POLL
 	while (!keyboardHit())
-	{
-		// Change border color to show frame timing
-		graphicsSetBorderC64Color(c & 15);
-		graphicsWaitVerticalBlank();
-		graphicsSetBorderC64Color(0);
-		c++;
-	}
+		rasterService();
+#else
+	rasterInstall();
+	while (!keyboardHit())
+		;
+	rasterRemove();
+#endif
+	rasterStop();
+
+	graphicsSetBorderC64Color(0);
 
 	return 0;
 }